@@ -153,18 +153,16 @@ void Appetizer::dietaryAccommodations(const DietaryRequest &request)
         {
             for (size_t i = 0; i < ingredients.size(); i++)
             {
-                if (ingredients[i].name == "Meat" || ingredients[i].name == "Chicken" || ingredients[i].name == "Fish" || 
-                    ingredients[i].name == "Beef" || ingredients[i].name == "Pork" || ingredients[i].name == "Lamb" || 
-                    ingredients[i].name == "Shrimp" || ingredients[i].name == "Bacon")
+                if (isNonVegetarian(ingredients[i]))
                 {
                     if (!first_replacement_done)
                     {
-                        ingredients[i].name = "Beans";  // First replacement
+                        ingredients[i].setName("Beans");  // First replacement
                         first_replacement_done = true;
                     }
                     else if (!second_replacement_done)
                     {
-                        ingredients[i].name = "Mushrooms";  // Second replacement
+                        ingredients[i].setName("Mushrooms");  // Second replacement
                         second_replacement_done = true;
                     }
                     else
@@ -195,9 +193,7 @@ void Appetizer::dietaryAccommodations(const DietaryRequest &request)
         {
             for (size_t i = 0; i < ingredients.size(); i++)
             {
-                if (ingredients[i].name == "Wheat" || ingredients[i].name == "Flour" || ingredients[i].name == "Bread" || 
-                    ingredients[i].name == "Pasta" || ingredients[i].name == "Barley" || ingredients[i].name == "Rye" || 
-                    ingredients[i].name == "Oats" || ingredients[i].name == "Crust")
+                if (containsGluten(ingredients[i]))
                 {
                     ingredients.erase(ingredients.begin() + i);
                     i--;  // Adjust the index after erasing
@@ -154,9 +154,7 @@ void Dessert::dietaryAccommodations(const DietaryRequest &request)
         {
             for (size_t i = 0; i < ingredients.size(); ++i)
             {
-                if (ingredients[i].name == "Almonds" || ingredients[i].name == "Walnuts" || ingredients[i].name == "Pecans" || 
-                    ingredients[i].name == "Hazelnuts" || ingredients[i].name == "Peanuts" || ingredients[i].name == "Cashews" || 
-                    ingredients[i].name == "Pistachios")
+                if (isNut(ingredients[i]))
                 {
                     ingredients.erase(ingredients.begin() + i);
                     i--;  // Adjust index after erase
@@ -186,8 +184,7 @@ void Dessert::dietaryAccommodations(const DietaryRequest &request)
         {
             for (size_t i = 0; i < ingredients.size(); ++i)
             {
-                if (ingredients[i].name == "Milk" || ingredients[i].name == "Eggs" || ingredients[i].name == "Cheese" || 
-                    ingredients[i].name == "Butter" || ingredients[i].name == "Cream" || ingredients[i].name == "Yogurt")
+                if (isDairyOrEgg(ingredients[i]))
                 {
                     ingredients.erase(ingredients.begin() + i);
                     i--;  // Adjust index after erase
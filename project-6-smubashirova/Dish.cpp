@@ -1,22 +1,29 @@
 #include "Dish.hpp"
+#include <algorithm>
+#include <iterator>
 
 // Default Constructor
 Dish::Dish() 
-    : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
+    : name_("UNKNOWN"), name_id_(NameTable::intern("UNKNOWN")), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
 }
 
 // Parameterized Constructor
 Dish::Dish(const std::string& name, const std::vector<Ingredient>& ingredients, int prep_time, double price, CuisineType cuisine_type)
-    : ingredients_(ingredients), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
+    : prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
     setName(name);  // Use setName to validate the name
+    setIngredients(ingredients);
 }
 
 // Accessor Functions
-std::string Dish::getName() const {
+const std::string& Dish::getName() const {
     return name_;
 }
 
-std::vector<Ingredient> Dish::getIngredients() const {
+int Dish::getNameId() const {
+    return name_id_;
+}
+
+const std::vector<Ingredient>& Dish::getIngredients() const {
     return ingredients_;
 }
 
@@ -47,10 +54,14 @@ void Dish::setName(const std::string& name) {
     } else {
         name_ = "UNKNOWN";
     }
+    name_id_ = NameTable::intern(name_);
 }
 
 void Dish::setIngredients(const std::vector<Ingredient>& ingredients) {
     ingredients_ = ingredients;
+    for (Ingredient& ingredient : ingredients_) {
+        ingredient.id = NameTable::intern(ingredient.name);
+    }
 }
 
 void Dish::setPrepTime(const int& prep_time) {
@@ -92,10 +103,38 @@ bool Dish::isValidName(const std::string& name) const {
 }
 
 bool Dish::operator==(const Dish& rhs) const {
-    return name_ == rhs.name_ && prep_time_ == rhs.prep_time_ && 
+    return name_id_ == rhs.name_id_ && prep_time_ == rhs.prep_time_ && 
     price_ == rhs.price_ && cuisine_type_ == rhs.cuisine_type_;
 }
 
 bool Dish::operator!=(const Dish& rhs) const {
     return !(*this == rhs);
-}
\ No newline at end of file
+}
+// Keyword checks: each list is interned once, on first use
+bool Dish::isNonVegetarian(const Ingredient& ingredient) {
+    static const int ids[] = {
+        NameTable::intern("Meat"), NameTable::intern("Chicken"), NameTable::intern("Fish"), NameTable::intern("Beef"),
+        NameTable::intern("Pork"), NameTable::intern("Lamb"), NameTable::intern("Shrimp"), NameTable::intern("Bacon")};
+    return std::find(std::begin(ids), std::end(ids), ingredient.id) != std::end(ids);
+}
+
+bool Dish::isDairyOrEgg(const Ingredient& ingredient) {
+    static const int ids[] = {
+        NameTable::intern("Milk"), NameTable::intern("Eggs"), NameTable::intern("Cheese"),
+        NameTable::intern("Butter"), NameTable::intern("Cream"), NameTable::intern("Yogurt")};
+    return std::find(std::begin(ids), std::end(ids), ingredient.id) != std::end(ids);
+}
+
+bool Dish::containsGluten(const Ingredient& ingredient) {
+    static const int ids[] = {
+        NameTable::intern("Wheat"), NameTable::intern("Flour"), NameTable::intern("Bread"), NameTable::intern("Pasta"),
+        NameTable::intern("Barley"), NameTable::intern("Rye"), NameTable::intern("Oats"), NameTable::intern("Crust")};
+    return std::find(std::begin(ids), std::end(ids), ingredient.id) != std::end(ids);
+}
+
+bool Dish::isNut(const Ingredient& ingredient) {
+    static const int ids[] = {
+        NameTable::intern("Almonds"), NameTable::intern("Walnuts"), NameTable::intern("Pecans"), NameTable::intern("Hazelnuts"),
+        NameTable::intern("Peanuts"), NameTable::intern("Cashews"), NameTable::intern("Pistachios")};
+    return std::find(std::begin(ids), std::end(ids), ingredient.id) != std::end(ids);
+}
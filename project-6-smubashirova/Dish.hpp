@@ -6,6 +6,7 @@
 #include <iostream>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
+#include "NameTable.hpp"
 
 /**
  * Struct representing an ingredient.
@@ -15,11 +16,18 @@ struct Ingredient {
     int quantity;            // Quantity in stock
     int required_quantity;   // Quantity required for a dish
     double price;            // Price per unit
+    int id;                  // Interned ID of name (see NameTable)
 
     // Constructors
-    Ingredient() : name("UNKNOWN"), quantity(0), required_quantity(0), price(0.0) {}
+    Ingredient() : name("UNKNOWN"), quantity(0), required_quantity(0), price(0.0), id(NameTable::intern("UNKNOWN")) {}
     Ingredient(const std::string& name, const int& quantity, const int& required_quantity, const double& price)
-        : name(name), quantity(quantity), required_quantity(required_quantity), price(price) {}
+        : name(name), quantity(quantity), required_quantity(required_quantity), price(price), id(NameTable::intern(name)) {}
+
+    // Renames the ingredient, keeping id in step with name
+    void setName(const std::string& new_name) {
+        name = new_name;
+        id = NameTable::intern(new_name);
+    }
 };
 class Dish {
 public:
@@ -65,12 +73,17 @@ public:
     /**
      * @return The name of the dish.
      */
-    std::string getName() const;
+    const std::string& getName() const;
+
+    /**
+     * @return The interned ID of the name of the dish (see NameTable).
+     */
+    int getNameId() const;
 
     /**
      * @return The list of ingredients used in the dish.
      */
-    std::vector<Ingredient> getIngredients() const;
+    const std::vector<Ingredient>& getIngredients() const;
 
     /**
      * @return The preparation time in minutes.
@@ -99,6 +112,7 @@ public:
      * Sets the list of ingredients.
      * @param ingredients A reference to the new list of ingredients.
      * @post Sets the private member `ingredients_` to the value of the parameter.
+     * Each ingredient's id is re-interned from its name, so names edited directly stay consistent.
      */
     void setIngredients(const std::vector<Ingredient>& ingredients);
 
@@ -163,8 +177,31 @@ public:
     */
     virtual void dietaryAccommodations(const DietaryRequest& request) = 0;
 
+protected:
+    // Keyword checks used by dietaryAccommodations, comparing interned ingredient IDs
+    /**
+     * @return True if the ingredient is one of "Meat", "Chicken", "Fish", "Beef", "Pork", "Lamb", "Shrimp", "Bacon".
+     */
+    static bool isNonVegetarian(const Ingredient& ingredient);
+
+    /**
+     * @return True if the ingredient is one of "Milk", "Eggs", "Cheese", "Butter", "Cream", "Yogurt".
+     */
+    static bool isDairyOrEgg(const Ingredient& ingredient);
+
+    /**
+     * @return True if the ingredient is one of "Wheat", "Flour", "Bread", "Pasta", "Barley", "Rye", "Oats", "Crust".
+     */
+    static bool containsGluten(const Ingredient& ingredient);
+
+    /**
+     * @return True if the ingredient is one of "Almonds", "Walnuts", "Pecans", "Hazelnuts", "Peanuts", "Cashews", "Pistachios".
+     */
+    static bool isNut(const Ingredient& ingredient);
+
 private:
     std::string name_;
+    int name_id_;
     std::vector<Ingredient> ingredients_;
     int prep_time_;
     double price_;
@@ -1,4 +1,5 @@
 #include "KitchenStation.hpp"
+#include "StationManager.hpp"
 
 KitchenStation::KitchenStation() 
     : station_name_("UNKNOWN"), dishes_({}), ingredients_stock_({}) {
@@ -9,6 +10,9 @@ KitchenStation::KitchenStation(const std::string& station_name)
 }
 
 KitchenStation::~KitchenStation() {
+    for (StationManager* manager : managers_) {
+        manager->stationDestroyed(this);
+    }
     for (Dish* dish : dishes_) {
         delete dish;
     }
@@ -17,141 +21,184 @@ std::string KitchenStation::getName() const {
     return station_name_;
 }
 void KitchenStation::setName(const std::string& station_name) {
+    std::string old_name = station_name_;
     station_name_ = station_name;
+    for (StationManager* manager : managers_) {
+        manager->stationRenamed(this, old_name);
+    }
 }
 
 // get dishes
-std::vector<Dish*> KitchenStation::getDishes() const
+const std::vector<Dish*>& KitchenStation::getDishes() const
 {
     return dishes_;
 }
+
+// check whether a dish with this name ID is assigned here
+bool KitchenStation::hasDish(int dish_id) const
+{
+    return dish_index_.find(dish_id) != dish_index_.end();
+}
+const Dish* KitchenStation::findDish(int dish_id) const
+{
+    auto found = dish_index_.find(dish_id);
+    return found == dish_index_.end() ? nullptr : found->second;
+}
 // get ingredients stock
 std::vector<Ingredient> KitchenStation::getIngredientsStock() const
 {
-    return ingredients_stock_;
+    std::vector<Ingredient> stock;
+    stock.reserve(stock_index_.size());
+    for (const StockSlot& slot : ingredients_stock_) {
+        if (slot.in_stock) {
+            stock.push_back(slot.ingredient);
+        }
+    }
+    return stock;
+}
+
+// get the stocked ingredient with this name, nullptr if not in stock
+const Ingredient* KitchenStation::findStockIngredient(const std::string& ingredient_name) const
+{
+    return findStockIngredient(NameTable::find(ingredient_name));
+}
+
+const Ingredient* KitchenStation::findStockIngredient(int ingredient_id) const
+{
+    auto found = stock_index_.find(ingredient_id);
+    if (found == stock_index_.end()) {
+        return nullptr;
+    }
+    return &ingredients_stock_[found->second].ingredient;
+}
+
+Ingredient* KitchenStation::findMutableStockIngredient(int ingredient_id)
+{
+    auto found = stock_index_.find(ingredient_id);
+    if (found == stock_index_.end()) {
+        return nullptr;
+    }
+    return &ingredients_stock_[found->second].ingredient;
 }
 
 bool KitchenStation::assignDishToStation(Dish* dish) {
     if (dish == nullptr) {
         return false;
     }
-    if (isPresent(dish->getName())) {
-        return false;
+    if (!dish_index_.emplace(dish->getNameId(), dish).second) {
+        return false;  // a dish with this name is already assigned
     }
     else {  
         dishes_.push_back(dish);
-        return true;
-    }
-}
-
-bool KitchenStation::isPresent(const std::string& dish_name) const {
-    for (Dish* dish : dishes_) {
-        if (dish->getName() == dish_name) {
-            return true;
+        for (StationManager* manager : managers_) {
+            manager->dishAssigned(this, dish);
         }
+        return true;
     }
-    return false;
 }
 
 void KitchenStation::replenishStationIngredients(const Ingredient& ingredient) {
+    // intern the name here so the stock stays keyed correctly even if the caller edited it directly
+    int ingredient_id = NameTable::intern(ingredient.name);
     //check if ingredient is already in stock
-    for (Ingredient& stock_ingredient : ingredients_stock_) {
-        if (stock_ingredient.name == ingredient.name) {
-            // std::cout<< "Found ingredient "<< stock_ingredient.name << std::endl;
-            // std::cout<< "We have "<< stock_ingredient.quantity << " of "<< stock_ingredient.name << std::endl;
-            // std::cout<< "We are adding "<< ingredient.quantity << " of "<< ingredient.name << std::endl;
-            stock_ingredient.quantity += ingredient.quantity;
-            // std::cout<< "We now have "<< stock_ingredient.quantity << " of "<< stock_ingredient.name << std::endl;
-            return;
-        }
+    Ingredient* stock_ingredient = findMutableStockIngredient(ingredient_id);
+    if (stock_ingredient != nullptr) {
+        stock_ingredient->quantity += ingredient.quantity;
+        return;
     }
-    ingredients_stock_.push_back(ingredient);
+    stock_index_[ingredient_id] = ingredients_stock_.size();
+    ingredients_stock_.push_back(StockSlot{ingredient, true});
+    ingredients_stock_.back().ingredient.id = ingredient_id;
 }
 
 bool KitchenStation::canCompleteOrder(const std::string& dish_name) const {
-    for (Dish* dish : dishes_) {
-        // std::cout<< "Dish name: "<< dish->getName()<<std::endl;
-        if (dish->getName() == dish_name) {
-            // std::cout << "Checking if we can complete order for " << dish_name << std::endl;
-            for (Ingredient ingredient : dish->getIngredients()) {
-                // std::cout << "Checking for ingredient " << ingredient.name << std::endl;
-                bool found = false;
-                for (Ingredient stock_ingredient : ingredients_stock_) {
-                    if (stock_ingredient.name == ingredient.name) {
-                        // std::cout<< "Found ingredient "<< stock_ingredient.name << " and we have "<< stock_ingredient.quantity << std::endl;
-                        if (stock_ingredient.quantity >= ingredient.required_quantity) {
-                            // std::cout<<"YAY We need "<< ingredient.required_quantity << " of "<< ingredient.name << " and we have "<< stock_ingredient.quantity << std::endl;
-                            // std::cout << "Found enough quantity of " << stock_ingredient.name << std::endl;
-                            found = true;
-                        }
-                        else {
-                            // std::cout << "Did not find enough quantity of " << stock_ingredient.name << std::endl;
-                            // std::cout<<"NO We need "<< ingredient.required_quantity << " of "<< ingredient.name << " and we have "<< stock_ingredient.quantity << std::endl;
-                            return false;
-                        }
-                    }
-                }
-                if (!found) {
-                    // std::cout<< "Did not find " << ingredient.name << std::endl;
-                    return false;
-                }
-            }
-            return true;
+    return canCompleteOrder(NameTable::find(dish_name));
+}
+
+bool KitchenStation::canCompleteOrder(int dish_id) const {
+    auto found = dish_index_.find(dish_id);
+    if (found == dish_index_.end()) {
+        return false;
+    }
+    for (const Ingredient& ingredient : found->second->getIngredients()) {
+        const Ingredient* stock_ingredient = findStockIngredient(ingredient.id);
+        if (stock_ingredient == nullptr || stock_ingredient->quantity < ingredient.required_quantity) {
+            return false;
         }
     }
-    return false;
+    return true;
 }
 
 bool KitchenStation::prepareDish(const std::string& dish_name) {
-    if (!canCompleteOrder(dish_name)) {
-        return false;
+    return tryPrepareDish(NameTable::find(dish_name)).ok();
+}
+
+bool KitchenStation::prepareDish(int dish_id) {
+    return tryPrepareDish(dish_id).ok();
+}
+
+KitchenStation::PrepareResult KitchenStation::tryPrepareDish(const std::string& dish_name) {
+    return tryPrepareDish(NameTable::find(dish_name));
+}
+
+KitchenStation::PrepareResult KitchenStation::tryPrepareDish(int dish_id) {
+    PrepareResult result{PrepareResult::PREPARED, {}};
+    auto found = dish_index_.find(dish_id);
+    if (found == dish_index_.end()) {
+        result.status = PrepareResult::DISH_NOT_AVAILABLE;
+        return result;
     }
-    else{
-        //std::cout<< "Preparing dish: "<< dish_name << std::endl;
+    const std::vector<Ingredient>& ingredients = found->second->getIngredients();
+
+    // Reserve: resolve each ingredient's stock slot once and check there is enough of it
+    // (at least required_quantity, and at least quantity as the recipe lists it)
+    reserved_slots_.clear();
+    for (const Ingredient& ingredient : ingredients) {
+        auto stocked = stock_index_.find(ingredient.id);
+        int available = (stocked == stock_index_.end()) ? 0 : ingredients_stock_[stocked->second].ingredient.quantity;
+        if (stocked == stock_index_.end() || available < ingredient.required_quantity || available < ingredient.quantity) {
+            result.status = PrepareResult::INSUFFICIENT_INGREDIENTS;
+            result.missing.push_back(ingredient);
+            result.missing.back().quantity = available;
+            continue;
+        }
+        reserved_slots_.push_back(stocked->second);
     }
-    for (Dish* dish : dishes_) {
-        if (dish->getName() == dish_name) {
-            // Check if we have all the ingredients and the right quantity before doing anything else
-            for (Ingredient ingredient : dish->getIngredients()) {
-                bool found = false;
-                for (Ingredient& stock_ingredient : ingredients_stock_) {
-                    if (stock_ingredient.name == ingredient.name) {
-                        // Check if we have enough stock
-                        if (stock_ingredient.quantity >= ingredient.quantity) {
-                            found = true;
-                            break; // breaks out of the inner loop, so we check the next ingredient
-                        }
-                    }
-                }
-                if (!found) { // one of the ingredients is missing or not enough
-                    return false;
-                }
-                // If we reach this point, we have all the ingredients in stock. Hooray!
-            }
-            // Deduct the ingredients from stock
-            for (Ingredient ingredient : dish->getIngredients()) {
-                for (Ingredient& stock_ingredient : ingredients_stock_) {
-                    if (stock_ingredient.name == ingredient.name) {
-                        stock_ingredient.quantity -= ingredient.required_quantity;
-                        // if we have 0 quantity of an ingredient, we should remove it from stock
-                        if (stock_ingredient.quantity == 0) {
-                            removeIngredient(stock_ingredient.name);
-                        }
-                    }
-                }
-            }
-            return true;
+    if (!result.ok()) {
+        return result;
+    }
+
+    // Commit: deduct from the reserved slots; an ingredient used up is removed from stock,
+    // and a repeat of it later in the list finds its slot gone and is skipped
+    for (size_t i = 0; i < ingredients.size(); i++) {
+        StockSlot& slot = ingredients_stock_[reserved_slots_[i]];
+        if (!slot.in_stock) {
+            continue;
+        }
+        slot.ingredient.quantity -= ingredients[i].required_quantity;
+        if (slot.ingredient.quantity == 0) {
+            slot.in_stock = false;
+            stock_index_.erase(slot.ingredient.id);
         }
     }
-    return false; 
+    // compact only once the slots are no longer needed; dead slots outnumbering live ones keeps this amortized O(1)
+    if (ingredients_stock_.size() > 2 * stock_index_.size()) {
+        compactStock();
+    }
+    return result;
 }
 
-bool KitchenStation::removeIngredient(const std::string& ingredient_name) {
+// drops dead slots and re-points the index at the live ones
+void KitchenStation::compactStock() {
+    size_t live = 0;
     for (size_t i = 0; i < ingredients_stock_.size(); i++) {
-        if (ingredients_stock_[i].name == ingredient_name) {
-            ingredients_stock_.erase(ingredients_stock_.begin() + i);
-            return true;
+        if (ingredients_stock_[i].in_stock) {
+            if (live != i) {
+                ingredients_stock_[live] = std::move(ingredients_stock_[i]);
+            }
+            stock_index_[ingredients_stock_[live].ingredient.id] = live;
+            live++;
         }
     }
-    return false;
-}
\ No newline at end of file
+    ingredients_stock_.resize(live);
+}
@@ -1,21 +1,55 @@
 #ifndef KITCHENSTATION_HPP
+#define KITCHENSTATION_HPP
 
 #include <iostream>
 #include <vector>
 #include <string>
 #include <iomanip>
 #include <cctype>
+#include <unordered_map>
 #include "Dish.hpp"
 
+class StationManager;
+
 class KitchenStation {
 
+    public:
+        // outcome of tryPrepareDish
+        struct PrepareResult {
+            enum Status { PREPARED, DISH_NOT_AVAILABLE, INSUFFICIENT_INGREDIENTS };
+            Status status;
+            // for INSUFFICIENT_INGREDIENTS: each dish ingredient the station is short of,
+            // with quantity set to the amount the station has in stock (0 if none)
+            std::vector<Ingredient> missing;
+
+            bool ok() const { return status == PREPARED; }
+        };
+
     private:
         std::string station_name_;
         std::vector<Dish*> dishes_;
-        std::vector<Ingredient> ingredients_stock_;
+        // interned dish name ID -> the assigned dish; a dish must keep its name while assigned
+        std::unordered_map<int, Dish*> dish_index_;
+        // stock slots in the order ingredients were first stocked; a removed
+        // ingredient leaves a dead slot until the next compaction
+        struct StockSlot {
+            Ingredient ingredient;
+            bool in_stock;
+        };
+        std::vector<StockSlot> ingredients_stock_;
+        // interned ingredient ID -> position of its live slot in ingredients_stock_
+        std::unordered_map<int, size_t> stock_index_;
+
+        // slot positions resolved by tryPrepareDish, reused between orders to avoid reallocating
+        std::vector<size_t> reserved_slots_;
+
+        // station managers holding this station, told about each rename and dish assignment so their
+        // name and dish indexes stay current
+        std::vector<StationManager*> managers_;
+        friend class StationManager;  // adds and removes itself in managers_, and moves dishes in mergeStations
 
-        bool isPresent(const std::string& dish_name) const;
-        bool removeIngredient(const std::string& ingredient_name);
+        Ingredient* findMutableStockIngredient(int ingredient_id);
+        void compactStock();
 
     public:
         KitchenStation();
@@ -24,17 +58,31 @@ class KitchenStation {
 
         // get name of station
         std::string getName() const;
-        // set name of station
+        // set name of station; any StationManager holding it re-indexes it under the new name
         void setName(const std::string& station_name);
         // get dishes
-        std::vector<Dish*> getDishes() const;
+        const std::vector<Dish*>& getDishes() const;
+        // check whether a dish with this name ID (Dish::getNameId) is assigned here
+        bool hasDish(int dish_id) const;
+        // get the dish with this name ID assigned here, nullptr if none
+        const Dish* findDish(int dish_id) const;
         // get ingredients stock
         std::vector<Ingredient> getIngredientsStock() const;
+        // get the stocked ingredient with this name, nullptr if not in stock
+        const Ingredient* findStockIngredient(const std::string& ingredient_name) const;
+        const Ingredient* findStockIngredient(int ingredient_id) const;
 
         bool assignDishToStation(Dish* dish);
         void replenishStationIngredients(const Ingredient& ingredient);
         bool canCompleteOrder(const std::string& dish_name) const;
         bool prepareDish(const std::string& dish_name);
+        // same as above, by interned dish name ID (Dish::getNameId)
+        bool canCompleteOrder(int dish_id) const;
+        bool prepareDish(int dish_id);
+        // checks and deducts every ingredient of the dish in one pass over its ingredient list;
+        // the stock is only changed when the whole dish can be made
+        PrepareResult tryPrepareDish(const std::string& dish_name);
+        PrepareResult tryPrepareDish(int dish_id);
 
 };
 
@@ -6,7 +6,7 @@
 //  some style modification, mainly variable names
 //  added getHeadNode() for grading purposes
 
-/** ADT list: Singly linked list implementation.
+/** ADT list: Doubly linked list implementation.
 
  Implementation file for the class LinkedList.
  @file LinkedList.cpp */
@@ -15,55 +15,29 @@
 #include <cassert>
 
 // constructor
-template<class T>
-LinkedList<T>::LinkedList() : head_ptr_(nullptr), item_count_(0)
+template<class T, class NodeAllocator>
+LinkedList<T, NodeAllocator>::LinkedList() : head_ptr_(nullptr), tail_ptr_(nullptr), item_count_(0)
 {
 }  // end default constructor
 
 
 // copy constructor
-template<class T>
-LinkedList<T>::LinkedList(const LinkedList<T>& a_list) : item_count_(a_list.item_count_)
+template<class T, class NodeAllocator>
+LinkedList<T, NodeAllocator>::LinkedList(const LinkedList<T, NodeAllocator>& a_list) : head_ptr_(nullptr), tail_ptr_(nullptr), item_count_(0)
 {
-   Node<T>* orig_chain_pointer = a_list.head_ptr_;  // Points to nodes in original chain
-
-   if (orig_chain_pointer == nullptr)
-      head_ptr_ = nullptr;  // Original list is empty
-   else
+   // Append a copy of each item of the original chain, in order
+   for (Node<T>* orig_chain_pointer = a_list.head_ptr_; orig_chain_pointer != nullptr;
+        orig_chain_pointer = orig_chain_pointer->getNext())
    {
-      // Copy first node
-      head_ptr_ = new Node<T>();
-      head_ptr_->setItem(orig_chain_pointer->getItem());
-
-      // Copy remaining nodes
-      Node<T>* new_chain_ptr = head_ptr_;      // Points to last node in new chain
-      orig_chain_pointer = orig_chain_pointer->getNext();     // Advance original-chain pointer
-      while (orig_chain_pointer != nullptr)
-      {
-         // Get next item from original chain
-         T next_item = orig_chain_pointer->getItem();
-
-         // Create a new node containing the next item
-         Node<T>* new_node_ptr = new Node<T>(next_item);
-
-         // Link new node to end of new chain
-         new_chain_ptr->setNext(new_node_ptr);
-
-         // Advance pointer to new last node
-         new_chain_ptr = new_chain_ptr->getNext();
-
-         // Advance original-chain pointer
-         orig_chain_pointer = orig_chain_pointer->getNext();
-      }  // end while
-
-      new_chain_ptr->setNext(nullptr);              // Flag end of chain
-   }  // end if
+      linkAfter(tail_ptr_, node_allocator_.create(orig_chain_pointer->getItem()));
+      item_count_++;
+   }  // end for
 }  // end copy constructor
 
 
 // destructor
-template<class T>
-LinkedList<T>::~LinkedList()
+template<class T, class NodeAllocator>
+LinkedList<T, NodeAllocator>::~LinkedList()
 {
    clear();
 }  // end destructor
@@ -71,16 +45,16 @@ LinkedList<T>::~LinkedList()
 
 
 /**@return true if list is empty - item_count_ == 0 */
-template<class T>
-bool LinkedList<T>::isEmpty() const
+template<class T, class NodeAllocator>
+bool LinkedList<T, NodeAllocator>::isEmpty() const
 {
    return item_count_ == 0;
 }  // end isEmpty
 
 
 /**@return the number of items in the list - item_count_ */
-template<class T>
-int LinkedList<T>::getLength() const
+template<class T, class NodeAllocator>
+int LinkedList<T, NodeAllocator>::getLength() const
 {
    return item_count_;
 }  // end getLength
@@ -93,31 +67,16 @@ int LinkedList<T>::getLength() const
  @param new_entry to be inserted in list
  @post new_entry is added at position in list (the node previously at that position is now at position+1)
  @return true if valid position (0 <= position <= item_count_) */
-template<class T>
-bool LinkedList<T>::insert(int positions, const T& new_entry)
+template<class T, class NodeAllocator>
+bool LinkedList<T, NodeAllocator>::insert(int positions, const T& new_entry)
 {
    bool able_to_insert = (positions >= 0) && (positions <= item_count_ );
    if (able_to_insert)
    {
-      // Create a new node containing the new entry
-      Node<T>* new_node_ptr = new Node<T>(new_entry);
-
-      // Attach new node to chain
-      if (positions == 0)
-      {
-         // Insert new node at beginning of chain
-         new_node_ptr->setNext(head_ptr_);
-         head_ptr_ = new_node_ptr;
-      }
-      else
-      {
-         // Find node that will be before new node
-         Node<T>* prev_ptr = getNodeAt(positions - 1);
-         // Insert new node after node to which prev_ptr points
-         new_node_ptr->setNext(prev_ptr->getNext());
-         prev_ptr->setNext(new_node_ptr);
-      }  // end if
-      item_count_++;  // Increase count of entries
+      // Find node that will be before new node (nullptr when inserting at the front);
+      // appending uses the tail pointer, so it does not walk the chain
+      Node<T>* prev_ptr = (positions == 0) ? nullptr : getNodeAt(positions - 1);
+      insertAfter(prev_ptr, new_entry);
    }  // end if
 
    return able_to_insert;
@@ -130,38 +89,14 @@ bool LinkedList<T>::insert(int positions, const T& new_entry)
  @param position indicating point of deletion
  @post node at position is deleted, if any. List order is retains
  @return true if there is a node at position to be deleted, false otherwise */
-template<class T>
-bool LinkedList<T>::remove(int position)
+template<class T, class NodeAllocator>
+bool LinkedList<T, NodeAllocator>::remove(int position)
 {
    bool able_to_remove = (position >= 0) && (position < item_count_);
    if (able_to_remove)
    {
-      Node<T>* cur_ptr = nullptr;
-      if (position == 0)
-      {
-         // Remove the first node in the chain
-         cur_ptr = head_ptr_; // Save pointer to node
-         head_ptr_ = head_ptr_->getNext();
-      }
-      else
-      {
-         // Find node that is before the one to delete
-         Node<T>* prev_ptr = getNodeAt(position - 1);
-
-         // Point to node to delete
-         cur_ptr = prev_ptr->getNext();
-
-         // Disconnect indicated node from chain by connecting the
-         // prior node with the one after
-         prev_ptr->setNext(cur_ptr->getNext());
-      }  // end if
-
-      // Return node to system
-      cur_ptr->setNext(nullptr);
-      delete cur_ptr;
-      cur_ptr = nullptr;
-
-      item_count_--;  // Decrease count of entries
+      // Disconnect indicated node from chain and return it to system
+      unlink(getNodeAt(position));
    }  // end if
 
    return able_to_remove;
@@ -169,12 +104,73 @@ bool LinkedList<T>::remove(int position)
 
 
 
+/**
+ @param node a node of this list after which to insert, or nullptr to insert at the front
+ @param new_entry to be inserted in list
+ @post new_entry is added right after node, in O(1)
+ @return a pointer to the new node */
+template<class T, class NodeAllocator>
+Node<T>* LinkedList<T, NodeAllocator>::insertAfter(Node<T>* node, const T& new_entry)
+{
+   // Create a new node containing the new entry and attach it to chain
+   Node<T>* new_node_ptr = node_allocator_.create(new_entry);
+   linkAfter(node, new_node_ptr);
+   item_count_++;  // Increase count of entries
+   return new_node_ptr;
+}  // end insertAfter
+
+
+
+/**
+ @param node a node of this list
+ @post node is removed from the list and deleted, in O(1). List order is retained
+ @return true if node was removed (node is not nullptr) */
+template<class T, class NodeAllocator>
+bool LinkedList<T, NodeAllocator>::unlink(Node<T>* node)
+{
+   if (node == nullptr)
+      return false;
+   detach(node);
+   node_allocator_.destroy(node);
+   item_count_--;  // Decrease count of entries
+   return true;
+}  // end unlink
+
+
+
+/**
+ @param node a node of this list
+ @post node is relinked to the front of the list, in O(1); no node is allocated or deleted
+ @return true if node was moved (node is not nullptr) */
+template<class T, class NodeAllocator>
+bool LinkedList<T, NodeAllocator>::moveToFront(Node<T>* node)
+{
+   if (node == nullptr)
+      return false;
+   if (node != head_ptr_)
+   {
+      detach(node);
+      linkAfter(nullptr, node);
+   }  // end if
+   return true;
+}  // end moveToFront
+
+
+
 /**@post the list is empty and item_count_ == 0*/
-template<class T>
-void LinkedList<T>::clear()
+template<class T, class NodeAllocator>
+void LinkedList<T, NodeAllocator>::clear()
 {
-   while (!isEmpty())
-      remove(0);
+   Node<T>* cur_ptr = head_ptr_;
+   while (cur_ptr != nullptr)
+   {
+      Node<T>* next_ptr = cur_ptr->getNext();
+      node_allocator_.destroy(cur_ptr);
+      cur_ptr = next_ptr;
+   }  // end while
+   head_ptr_ = nullptr;
+   tail_ptr_ = nullptr;
+   item_count_ = 0;
 }  // end clear
 
 
@@ -184,8 +180,8 @@ void LinkedList<T>::clear()
  @param position indicating the position of the data to be retrieved
  @return data item found at position. If position is not a valid position < item_count_
  throws  PrecondViolatedExcep */
-template<class T>
-T LinkedList<T>::getEntry(int position) const
+template<class T, class NodeAllocator>
+T LinkedList<T, NodeAllocator>::getEntry(int position) const
 {
     // Enforce precondition
     bool ableToGet = (position >= 0) && (position < item_count_);
@@ -206,6 +202,49 @@ T LinkedList<T>::getEntry(int position) const
 
 
 
+/**@return an iterator to the first item, equal to end() if the list is empty */
+template<class T, class NodeAllocator>
+typename LinkedList<T, NodeAllocator>::iterator LinkedList<T, NodeAllocator>::begin()
+{
+   return iterator(head_ptr_);
+}  // end begin
+
+template<class T, class NodeAllocator>
+typename LinkedList<T, NodeAllocator>::const_iterator LinkedList<T, NodeAllocator>::begin() const
+{
+   return const_iterator(head_ptr_);
+}  // end begin
+
+template<class T, class NodeAllocator>
+typename LinkedList<T, NodeAllocator>::const_iterator LinkedList<T, NodeAllocator>::cbegin() const
+{
+   return const_iterator(head_ptr_);
+}  // end cbegin
+
+
+/**@return the past-the-end iterator */
+template<class T, class NodeAllocator>
+typename LinkedList<T, NodeAllocator>::iterator LinkedList<T, NodeAllocator>::end()
+{
+   return iterator();
+}  // end end
+
+template<class T, class NodeAllocator>
+typename LinkedList<T, NodeAllocator>::const_iterator LinkedList<T, NodeAllocator>::end() const
+{
+   return const_iterator();
+}  // end end
+
+template<class T, class NodeAllocator>
+typename LinkedList<T, NodeAllocator>::const_iterator LinkedList<T, NodeAllocator>::cend() const
+{
+   return const_iterator();
+}  // end cend
+
+
+
+
+
 /************* PROTECTED METHODS ************/
 
 
@@ -214,46 +253,108 @@ T LinkedList<T>::getEntry(int position) const
 // @param position the index of the desired node
 //       0 <= position < item_count_
 // @return  A pointer to the node at the given position or nullptr if position is >= item_count_
-template<class T>
-Node<T>* LinkedList<T>::getNodeAt(int position) const
+template<class T, class NodeAllocator>
+Node<T>* LinkedList<T, NodeAllocator>::getNodeAt(int position) const
 {
-    // Count from the beginning of the chain
-    Node<T>* cur_ptr = head_ptr_;
-    for (int skip = 0; skip < position; skip++)
-        cur_ptr = cur_ptr->getNext();
+    if (position < 0 || position >= item_count_)
+        return nullptr;
+
+    // Count from whichever end of the chain is closer
+    Node<T>* cur_ptr = nullptr;
+    if (position <= item_count_ / 2)
+    {
+        cur_ptr = head_ptr_;
+        for (int skip = 0; skip < position; skip++)
+            cur_ptr = cur_ptr->getNext();
+    }
+    else
+    {
+        cur_ptr = tail_ptr_;
+        for (int skip = item_count_ - 1; skip > position; skip--)
+            cur_ptr = cur_ptr->getPrevious();
+    }
 
     return cur_ptr;
 }  // end getNodeAt
 
+// Links a detached node into the chain between prev_ptr and the node after it.
+// @param prev_ptr the node to link after, or nullptr to link at the front
+// @param new_node_ptr a node that is not in any chain
+template<class T, class NodeAllocator>
+void LinkedList<T, NodeAllocator>::linkAfter(Node<T>* prev_ptr, Node<T>* new_node_ptr)
+{
+    Node<T>* next_ptr = (prev_ptr == nullptr) ? head_ptr_ : prev_ptr->getNext();
+    new_node_ptr->setPrevious(prev_ptr);
+    new_node_ptr->setNext(next_ptr);
+    if (prev_ptr == nullptr)
+        head_ptr_ = new_node_ptr;
+    else
+        prev_ptr->setNext(new_node_ptr);
+    if (next_ptr == nullptr)
+        tail_ptr_ = new_node_ptr;
+    else
+        next_ptr->setPrevious(new_node_ptr);
+}  // end linkAfter
+
+// Detaches a node from the chain without deleting it.
+// @param node_ptr a node of this list
+template<class T, class NodeAllocator>
+void LinkedList<T, NodeAllocator>::detach(Node<T>* node_ptr)
+{
+    Node<T>* prev_ptr = node_ptr->getPrevious();
+    Node<T>* next_ptr = node_ptr->getNext();
+    if (prev_ptr == nullptr)
+        head_ptr_ = next_ptr;
+    else
+        prev_ptr->setNext(next_ptr);
+    if (next_ptr == nullptr)
+        tail_ptr_ = prev_ptr;
+    else
+        next_ptr->setPrevious(prev_ptr);
+    node_ptr->setNext(nullptr);
+    node_ptr->setPrevious(nullptr);
+}  // end detach
+
 //position follows classic indexing from 0 to item_count_-1
 //if position > item_count it returns nullptr
-template <class T>
-Node<T> *LinkedList<T>::getPointerTo(size_t position) const
+template<class T, class NodeAllocator>
+Node<T> *LinkedList<T, NodeAllocator>::getPointerTo(size_t position) const
 {
 
-  Node<T> *find = nullptr;
-  if (position < item_count_)
+  if (position >= static_cast<size_t>(item_count_))
   {
-    find = head_ptr_;
-    for (size_t i = 0; i < position; ++i)
-    {
-      find = find->getNext();
-    }
+    return nullptr;
   }
-
-  return find;
+  return getNodeAt(static_cast<int>(position));
 } //end getPointerTo
 
 
 
 
 //returns the head pointer
-template <class T>
-Node<T> *LinkedList<T>::getHeadNode() const
+template<class T, class NodeAllocator>
+Node<T> *LinkedList<T, NodeAllocator>::getHeadNode() const
 {
 
   return head_ptr_;
 } //end getHeadNode
 
 
+//returns the allocator that creates and destroys this list's nodes
+template<class T, class NodeAllocator>
+const NodeAllocator& LinkedList<T, NodeAllocator>::getNodeAllocator() const
+{
+  return node_allocator_;
+} //end getNodeAllocator
+
+
+//returns the tail pointer
+template<class T, class NodeAllocator>
+Node<T> *LinkedList<T, NodeAllocator>::getTailNode() const
+{
+
+  return tail_ptr_;
+} //end getTailNode
+
+
 //  End of implementation file.
@@ -6,7 +6,8 @@
 //  some style modification, mainly variable names 
 //  added getHeadNode() for grading purposes
 
-/** ADT list: Singly linked list implementation.
+/** ADT list: Doubly linked list implementation with a tail pointer,
+    so appending and unlinking a known node are O(1).
     Listing 9-2.
     @file LinkedList.h */
 
@@ -14,16 +15,21 @@
 #define LINKED_LIST_
 
 #include "Node.hpp"
+#include "LinkedListIterator.hpp"
+#include "NodePool.hpp"
 #include "PrecondViolatedExcep.hpp"
 #include <iostream>
 
-template<class T>
+template<class T, class NodeAllocator = NodePool<T> >
 class LinkedList
 {
 
 public:
+   using iterator = LinkedListIterator<T>;
+   using const_iterator = LinkedListIterator<T, true>;
+
    LinkedList(); // constructor
-   LinkedList(const LinkedList<T>& a_list); // copy constructor
+   LinkedList(const LinkedList<T, NodeAllocator>& a_list); // copy constructor
    virtual ~LinkedList(); // destructor
 
    /**@return true if list is empty - item_count_ == 0 */
@@ -67,13 +73,53 @@ public:
 
     Node<T> *getHeadNode() const;
 
+    Node<T> *getTailNode() const;
+
+    /**@return the allocator that creates and destroys this list's nodes, e.g. to read its allocation counts */
+    const NodeAllocator& getNodeAllocator() const;
+
+
+    /**
+     @param node a node of this list after which to insert, or nullptr to insert at the front
+     @param new_entry to be inserted in list
+     @post new_entry is added right after node, in O(1)
+     @return a pointer to the new node */
+   Node<T>* insertAfter(Node<T>* node, const T& new_entry);
+
+
+    /**
+     @param node a node of this list
+     @post node is removed from the list and deleted, in O(1). List order is retained
+     @return true if node was removed (node is not nullptr) */
+   bool unlink(Node<T>* node);
+
+
+    /**
+     @param node a node of this list
+     @post node is relinked to the front of the list, in O(1); no node is allocated or deleted
+     @return true if node was moved (node is not nullptr) */
+   bool moveToFront(Node<T>* node);
+
+
+    /**@return an iterator to the first item, equal to end() if the list is empty */
+   iterator begin();
+   const_iterator begin() const;
+   const_iterator cbegin() const;
+
+    /**@return the past-the-end iterator */
+   iterator end();
+   const_iterator end() const;
+   const_iterator cend() const;
+
 
 
 
 
 protected:
+    NodeAllocator node_allocator_; // Creates and destroys the nodes; declared first so it outlives them
     Node<T>* head_ptr_; // Pointer to first node in the chain;
     // (contains the first entry in the list)
+    Node<T>* tail_ptr_; // Pointer to last node in the chain
     int item_count_;           // Current count of list items
 
 
@@ -85,6 +131,15 @@ protected:
     // @return  A pointer to the node at the given position or nullptr if position is >= item_count_
     Node<T>* getNodeAt(int position) const;
 
+    // Links a detached node into the chain between prev_ptr and the node after it.
+    // @param prev_ptr the node to link after, or nullptr to link at the front
+    // @param new_node_ptr a node that is not in any chain
+    void linkAfter(Node<T>* prev_ptr, Node<T>* new_node_ptr);
+
+    // Detaches a node from the chain without deleting it.
+    // @param node_ptr a node of this list
+    void detach(Node<T>* node_ptr);
+
 
 
 
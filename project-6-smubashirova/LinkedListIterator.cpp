@@ -0,0 +1,78 @@
+/** @file LinkedListIterator.cpp
+    Implementation file for the class LinkedListIterator */
+
+#include "LinkedListIterator.hpp"
+
+// default constructor
+template<class T, bool IsConst>
+LinkedListIterator<T, IsConst>::LinkedListIterator() : node_ptr_(nullptr)
+{
+}  // end default constructor
+
+// constructor
+template<class T, bool IsConst>
+LinkedListIterator<T, IsConst>::LinkedListIterator(node_pointer node_ptr) : node_ptr_(node_ptr)
+{
+}  // end constructor
+
+// converting constructor (iterator to const_iterator)
+template<class T, bool IsConst>
+template<bool OtherConst, class>
+LinkedListIterator<T, IsConst>::LinkedListIterator(const LinkedListIterator<T, OtherConst>& other)
+   : node_ptr_(other.getNode())
+{
+}  // end converting constructor
+
+
+
+/** @pre the iterator is not past-the-end
+    @return a reference to the item at the current node */
+template<class T, bool IsConst>
+typename LinkedListIterator<T, IsConst>::reference LinkedListIterator<T, IsConst>::operator*() const
+{
+   return node_ptr_->getItem();
+}  // end operator*
+
+template<class T, bool IsConst>
+typename LinkedListIterator<T, IsConst>::pointer LinkedListIterator<T, IsConst>::operator->() const
+{
+   return &node_ptr_->getItem();
+}  // end operator->
+
+/** @post the iterator refers to the next node, or is past-the-end */
+template<class T, bool IsConst>
+LinkedListIterator<T, IsConst>& LinkedListIterator<T, IsConst>::operator++()
+{
+   node_ptr_ = node_ptr_->getNext();
+   return *this;
+}  // end operator++
+
+template<class T, bool IsConst>
+LinkedListIterator<T, IsConst> LinkedListIterator<T, IsConst>::operator++(int)
+{
+   LinkedListIterator<T, IsConst> previous = *this;
+   ++(*this);
+   return previous;
+}  // end operator++
+
+/** @return true if both iterators refer to the same node (or both are past-the-end) */
+template<class T, bool IsConst>
+bool LinkedListIterator<T, IsConst>::operator==(const LinkedListIterator& other) const
+{
+   return node_ptr_ == other.node_ptr_;
+}  // end operator==
+
+template<class T, bool IsConst>
+bool LinkedListIterator<T, IsConst>::operator!=(const LinkedListIterator& other) const
+{
+   return node_ptr_ != other.node_ptr_;
+}  // end operator!=
+
+/** @return the current node, nullptr if past-the-end */
+template<class T, bool IsConst>
+typename LinkedListIterator<T, IsConst>::node_pointer LinkedListIterator<T, IsConst>::getNode() const
+{
+   return node_ptr_;
+}  // end getNode
+
+//  End of implementation file.
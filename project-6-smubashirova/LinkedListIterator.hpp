@@ -0,0 +1,60 @@
+/** @file LinkedListIterator.hpp
+    STL forward iterator over the items of a LinkedList */
+
+#ifndef LINKED_LIST_ITERATOR_
+#define LINKED_LIST_ITERATOR_
+
+#include "Node.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/** An STL forward iterator over the items of a LinkedList.
+    It holds a single node pointer and advances along getNext(), so a full
+    sweep of the list is linear. With IsConst == true the items are read-only
+    (the list's const_iterator); a mutable iterator converts to a const one.
+    Removing the node an iterator refers to invalidates that iterator only. */
+template<class T, bool IsConst = false>
+class LinkedListIterator
+{
+public:
+   using iterator_category = std::forward_iterator_tag;
+   using value_type = T;
+   using difference_type = std::ptrdiff_t;
+   using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+   using reference = typename std::conditional<IsConst, const T&, T&>::type;
+   using node_pointer = typename std::conditional<IsConst, const Node<T>*, Node<T>*>::type;
+
+   /** Default constructor.
+       @post the iterator is the past-the-end iterator */
+   LinkedListIterator();
+
+   /** @param node_ptr the node to refer to, nullptr for past-the-end */
+   explicit LinkedListIterator(node_pointer node_ptr);
+
+   /** @post a const iterator refers to the same node as the mutable iterator other */
+   template<bool OtherConst, class = typename std::enable_if<IsConst && !OtherConst>::type>
+   LinkedListIterator(const LinkedListIterator<T, OtherConst>& other);
+
+   /** @pre the iterator is not past-the-end
+       @return a reference to the item at the current node */
+   reference operator*() const;
+   pointer operator->() const;
+
+   /** @post the iterator refers to the next node, or is past-the-end */
+   LinkedListIterator& operator++();
+   LinkedListIterator operator++(int);
+
+   /** @return true if both iterators refer to the same node (or both are past-the-end) */
+   bool operator==(const LinkedListIterator& other) const;
+   bool operator!=(const LinkedListIterator& other) const;
+
+   /** @return the current node, nullptr if past-the-end */
+   node_pointer getNode() const;
+
+private:
+   node_pointer node_ptr_; // Current node; nullptr when past-the-end
+}; // end LinkedListIterator
+
+#include "LinkedListIterator.cpp"
+#endif
@@ -159,18 +159,16 @@ void MainCourse::dietaryAccommodations(const DietaryRequest &request)
 
         for (size_t i = 0; i < ingredients.size(); ++i)
         {
-            if (ingredients[i].name == "Meat" || ingredients[i].name == "Chicken" || ingredients[i].name == "Fish" || 
-                ingredients[i].name == "Beef" || ingredients[i].name == "Pork" || ingredients[i].name == "Lamb" || 
-                ingredients[i].name == "Shrimp" || ingredients[i].name == "Bacon")
+            if (isNonVegetarian(ingredients[i]))
             {
                 if (!first_replacement_done)
                 {
-                    ingredients[i].name = "Beans";  // First replacement
+                    ingredients[i].setName("Beans");  // First replacement
                     first_replacement_done = true;
                 }
                 else if (!second_replacement_done)
                 {
-                    ingredients[i].name = "Mushrooms";  // Second replacement
+                    ingredients[i].setName("Mushrooms");  // Second replacement
                     second_replacement_done = true;
                 }
                 else
@@ -195,8 +193,7 @@ void MainCourse::dietaryAccommodations(const DietaryRequest &request)
         {
             for (size_t i = 0; i < ingredients.size(); ++i)
             {
-                if (ingredients[i].name == "Milk" || ingredients[i].name == "Eggs" || ingredients[i].name == "Cheese" || 
-                    ingredients[i].name == "Butter" || ingredients[i].name == "Cream" || ingredients[i].name == "Yogurt")
+                if (isDairyOrEgg(ingredients[i]))
                 {
                     ingredients.erase(ingredients.begin() + i);  // Remove non-vegan item
                     i--;  // Adjust index after erase
@@ -0,0 +1,40 @@
+/**
+ * @file NameTable.cpp
+ * @brief Global string-interning table for ingredient and dish names.
+*/
+
+#include "NameTable.hpp"
+
+NameTable& NameTable::instance() {
+    static NameTable table;
+    return table;
+}
+
+int NameTable::intern(const std::string& name) {
+    NameTable& table = instance();
+    auto found = table.ids_.find(name);
+    if (found != table.ids_.end()) {
+        return found->second;
+    }
+    int id = static_cast<int>(table.names_.size());
+    auto inserted = table.ids_.emplace(name, id).first;
+    table.names_.push_back(&inserted->first);
+    return id;
+}
+
+int NameTable::find(const std::string& name) {
+    const NameTable& table = instance();
+    auto found = table.ids_.find(name);
+    if (found == table.ids_.end()) {
+        return NO_ID;
+    }
+    return found->second;
+}
+
+const std::string& NameTable::nameOf(int id) {
+    return *instance().names_[id];
+}
+
+int NameTable::size() {
+    return static_cast<int>(instance().names_.size());
+}
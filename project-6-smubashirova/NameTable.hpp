@@ -0,0 +1,54 @@
+/**
+ * @file NameTable.hpp
+ * @brief Global string-interning table for ingredient and dish names.
+ *
+ * Every distinct name is given a compact integer ID the first time it is interned.
+ * IDs are never reused, so two names are equal exactly when their IDs are equal,
+ * and code on the order path can compare IDs instead of strings.
+*/
+
+#ifndef NAMETABLE_HPP
+#define NAMETABLE_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map> //std::unordered_map, find, emplace
+
+class NameTable {
+public:
+    // ID returned by find() for a name that was never interned; no dish or ingredient has it
+    static const int NO_ID = -1;
+
+    /**
+     * @param name A string to be interned.
+     * @post: If name was not in the table, it is added with the next free ID.
+     * @return: The ID of name.
+    */
+    static int intern(const std::string& name);
+
+    /**
+     * @param name A string to look up.
+     * @return: The ID of name, or NO_ID if it was never interned. The table is not modified.
+    */
+    static int find(const std::string& name);
+
+    /**
+     * @param id An ID returned by intern().
+     * @return: The name with that ID.
+    */
+    static const std::string& nameOf(int id);
+
+    /**
+     * @return: The number of distinct names interned so far.
+    */
+    static int size();
+
+private:
+    std::unordered_map<std::string, int> ids_;
+    std::vector<const std::string*> names_; // names_[id] points at the key in ids_, which never moves
+
+    // the single table, created on first use so it is ready during static initialization
+    static NameTable& instance();
+};
+
+#endif
@@ -3,7 +3,7 @@
 //  Modified by Tiziana Ligorio for Hunter College CSCI 235
 
 /** @file Node.hpp
-    Node for Singly Linked Chain*/
+    Node for Doubly Linked Chain*/
 
 #ifndef NODE_
 #define NODE_
@@ -24,15 +24,24 @@ public:
      @post sets next_ to next_node_ptr */
    void setNext(Node<T>* next_node_ptr);
     
+    /** @param previous_node_ptr points to the previous node in the chain
+     @post sets previous_ to previous_node_ptr */
+   void setPrevious(Node<T>* previous_node_ptr);
+
     /**@return item_*/
-   T getItem() const ;
+   const T& getItem() const ;
+   T& getItem();   // In-place access, used by LinkedListIterator
     
     /**@return next_*/
    Node<T>* getNext() const ;
+
+    /**@return previous_*/
+   Node<T>* getPrevious() const ;
     
 private:
     T        item_; // A data item_
     Node<T>* next_; // Pointer to next_ node
+    Node<T>* previous_; // Pointer to previous_ node
 }; // end Node
 
 #include "Node.cpp"
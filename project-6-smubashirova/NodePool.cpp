@@ -0,0 +1,180 @@
+/** @file NodePool.cpp
+    Implementation file for the node allocators NodePool and HeapNodeAllocator */
+
+#include "NodePool.hpp"
+#include <new>
+
+/************* NodePool ************/
+
+// constructor
+template<class T>
+NodePool<T>::NodePool() : free_list_(nullptr), slab_cursor_(nullptr), slab_end_(nullptr),
+                          next_slab_nodes_(FIRST_SLAB_NODES), heap_allocations_(0),
+                          nodes_created_(0), nodes_reused_(0), nodes_in_use_(0)
+{
+}  // end constructor
+
+
+// destructor
+template<class T>
+NodePool<T>::~NodePool()
+{
+   // Every node must already have been destroyed by the owning list
+   for (void* slab : slabs_)
+      ::operator delete(slab);
+}  // end destructor
+
+
+
+/** @param an_item the item to be stored
+    @return a pointer to a new unlinked node holding an_item, reusing a freed slot if there is one */
+template<class T>
+Node<T>* NodePool<T>::create(const T& an_item)
+{
+   void* slot = takeSlot();
+   Node<T>* node_ptr = new (slot) Node<T>(an_item);
+   nodes_created_++;
+   nodes_in_use_++;
+   return node_ptr;
+}  // end create
+
+
+/** @param node_ptr a node returned by create() on this pool
+    @post the node is destroyed and its slot is put on the free list */
+template<class T>
+void NodePool<T>::destroy(Node<T>* node_ptr)
+{
+   node_ptr->~Node<T>();
+   FreeSlot* slot = new (static_cast<void*>(node_ptr)) FreeSlot;
+   slot->next = free_list_;
+   free_list_ = slot;
+   nodes_in_use_--;
+}  // end destroy
+
+
+/**@return the number of slabs requested from the heap so far */
+template<class T>
+std::size_t NodePool<T>::getHeapAllocations() const
+{
+   return heap_allocations_;
+}  // end getHeapAllocations
+
+
+/**@return the number of nodes created so far */
+template<class T>
+std::size_t NodePool<T>::getNodesCreated() const
+{
+   return nodes_created_;
+}  // end getNodesCreated
+
+
+/**@return the number of nodes created from a freed slot instead of fresh slab space */
+template<class T>
+std::size_t NodePool<T>::getNodesReused() const
+{
+   return nodes_reused_;
+}  // end getNodesReused
+
+
+/**@return the number of nodes currently alive */
+template<class T>
+std::size_t NodePool<T>::getNodesInUse() const
+{
+   return nodes_in_use_;
+}  // end getNodesInUse
+
+
+/** @return storage for one node, from the free list or the newest slab */
+template<class T>
+void* NodePool<T>::takeSlot()
+{
+   if (free_list_ != nullptr)
+   {
+      FreeSlot* slot = free_list_;
+      free_list_ = slot->next;
+      nodes_reused_++;
+      return slot;
+   }  // end if
+   if (slab_cursor_ == slab_end_)
+      addSlab();
+   return slab_cursor_++;
+}  // end takeSlot
+
+
+/** @post a new slab is allocated and becomes the newest slab */
+template<class T>
+void NodePool<T>::addSlab()
+{
+   void* slab = ::operator new(next_slab_nodes_ * sizeof(Node<T>));
+   slabs_.push_back(slab);
+   heap_allocations_++;
+   slab_cursor_ = static_cast<Node<T>*>(slab);
+   slab_end_ = slab_cursor_ + next_slab_nodes_;
+   if (next_slab_nodes_ < MAX_SLAB_NODES)
+      next_slab_nodes_ *= 2;
+}  // end addSlab
+
+
+
+/************* HeapNodeAllocator ************/
+
+// constructor
+template<class T>
+HeapNodeAllocator<T>::HeapNodeAllocator() : nodes_created_(0), nodes_in_use_(0)
+{
+}  // end constructor
+
+
+/** @param an_item the item to be stored
+    @return a pointer to a new unlinked node holding an_item */
+template<class T>
+Node<T>* HeapNodeAllocator<T>::create(const T& an_item)
+{
+   nodes_created_++;
+   nodes_in_use_++;
+   return new Node<T>(an_item);
+}  // end create
+
+
+/** @param node_ptr a node returned by create() on this allocator
+    @post the node is deleted */
+template<class T>
+void HeapNodeAllocator<T>::destroy(Node<T>* node_ptr)
+{
+   delete node_ptr;
+   nodes_in_use_--;
+}  // end destroy
+
+
+/**@return the number of nodes requested from the heap so far */
+template<class T>
+std::size_t HeapNodeAllocator<T>::getHeapAllocations() const
+{
+   return nodes_created_;
+}  // end getHeapAllocations
+
+
+/**@return the number of nodes created so far */
+template<class T>
+std::size_t HeapNodeAllocator<T>::getNodesCreated() const
+{
+   return nodes_created_;
+}  // end getNodesCreated
+
+
+/**@return 0, nodes are never reused */
+template<class T>
+std::size_t HeapNodeAllocator<T>::getNodesReused() const
+{
+   return 0;
+}  // end getNodesReused
+
+
+/**@return the number of nodes currently alive */
+template<class T>
+std::size_t HeapNodeAllocator<T>::getNodesInUse() const
+{
+   return nodes_in_use_;
+}  // end getNodesInUse
+
+//  End of implementation file.
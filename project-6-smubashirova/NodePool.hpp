@@ -0,0 +1,110 @@
+/** @file NodePool.hpp
+    Node allocator policies for LinkedList */
+
+#ifndef NODE_POOL_
+#define NODE_POOL_
+
+#include "Node.hpp"
+#include <cstddef>
+#include <vector>
+
+/** The default node allocator of LinkedList.
+    Nodes are carved out of slabs of raw storage owned by the pool; a
+    destroyed node goes onto a free list and is handed out again by the next
+    create(), so steady insert/remove churn does not call malloc at all.
+    Slabs double in size (up to MAX_SLAB_NODES) and are only released when
+    the pool is destroyed, so node addresses stay valid while in use.
+    A pool belongs to exactly one list and cannot be copied. */
+template<class T>
+class NodePool
+{
+public:
+   NodePool(); // constructor
+   NodePool(const NodePool<T>&) = delete;
+   NodePool<T>& operator=(const NodePool<T>&) = delete;
+   ~NodePool(); // destructor, releases every slab
+
+   /** @param an_item the item to be stored
+       @return a pointer to a new unlinked node holding an_item, reusing a freed slot if there is one */
+   Node<T>* create(const T& an_item);
+
+   /** @param node_ptr a node returned by create() on this pool
+       @post the node is destroyed and its slot is put on the free list */
+   void destroy(Node<T>* node_ptr);
+
+   /**@return the number of slabs requested from the heap so far */
+   std::size_t getHeapAllocations() const;
+
+   /**@return the number of nodes created so far */
+   std::size_t getNodesCreated() const;
+
+   /**@return the number of nodes created from a freed slot instead of fresh slab space */
+   std::size_t getNodesReused() const;
+
+   /**@return the number of nodes currently alive */
+   std::size_t getNodesInUse() const;
+
+private:
+   static const std::size_t FIRST_SLAB_NODES = 16;
+   static const std::size_t MAX_SLAB_NODES = 4096;
+
+   // A freed slot reuses the node's storage to link to the next free slot
+   struct FreeSlot
+   {
+      FreeSlot* next;
+   };
+
+   std::vector<void*> slabs_;    // Raw storage, in allocation order
+   FreeSlot* free_list_;         // Freed slots, most recently freed first
+   Node<T>* slab_cursor_;        // Next never-used slot in the newest slab
+   Node<T>* slab_end_;           // One past the last slot of the newest slab
+   std::size_t next_slab_nodes_; // Capacity of the next slab to allocate
+
+   std::size_t heap_allocations_;
+   std::size_t nodes_created_;
+   std::size_t nodes_reused_;
+   std::size_t nodes_in_use_;
+
+   /** @return storage for one node, from the free list or the newest slab */
+   void* takeSlot();
+
+   /** @post a new slab is allocated and becomes the newest slab */
+   void addSlab();
+}; // end NodePool
+
+
+/** A node allocator that news and deletes every node individually,
+    with the same counters as NodePool. */
+template<class T>
+class HeapNodeAllocator
+{
+public:
+   HeapNodeAllocator(); // constructor
+
+   /** @param an_item the item to be stored
+       @return a pointer to a new unlinked node holding an_item */
+   Node<T>* create(const T& an_item);
+
+   /** @param node_ptr a node returned by create() on this allocator
+       @post the node is deleted */
+   void destroy(Node<T>* node_ptr);
+
+   /**@return the number of nodes requested from the heap so far */
+   std::size_t getHeapAllocations() const;
+
+   /**@return the number of nodes created so far */
+   std::size_t getNodesCreated() const;
+
+   /**@return 0, nodes are never reused */
+   std::size_t getNodesReused() const;
+
+   /**@return the number of nodes currently alive */
+   std::size_t getNodesInUse() const;
+
+private:
+   std::size_t nodes_created_;
+   std::size_t nodes_in_use_;
+}; // end HeapNodeAllocator
+
+#include "NodePool.cpp"
+#endif
@@ -10,12 +10,71 @@
 #include "StationManager.hpp"
 #include <iostream>
 #include <string>
+#include <algorithm> //std::find, std::lower_bound
+#include <utility> //std::pair, std::make_pair
 
 /**
     * Default Constructor
     * @post: Initializes an empty station manager.
 */
-StationManager::StationManager() {}
+StationManager::StationManager() : front_order_(0), back_order_(-1), backup_dead_(0) {}
+
+/**
+    * Copy Constructor
+    * @param other The station manager to copy.
+    * @post: Holds the same station pointers, dish queue and backup stock as other, with its own
+    * name, dish and order indexes rebuilt over its own list nodes.
+*/
+StationManager::StationManager(const StationManager& other)
+    : LinkedList<KitchenStation*>(other), dish_queue_(other.dish_queue_),
+      backup_ingredients_(other.backup_ingredients_), backup_dead_(other.backup_dead_), backup_index_(other.backup_index_) {
+    rebuildStationIndexes();  // The copied indexes would point into other's nodes
+}
+
+/**
+    * Copy Assignment Operator
+    * @param other The station manager to copy.
+    * @post: Same as the copy constructor; the previous list nodes are freed (the stations are not).
+    * @return: A reference to this station manager.
+*/
+StationManager& StationManager::operator=(const StationManager& other) {
+    if (this != &other) {
+        clear();
+        for (KitchenStation* station : other) {
+            insertAfter(getTailNode(), station);
+        }
+        dish_queue_ = other.dish_queue_;
+        backup_ingredients_ = other.backup_ingredients_;
+        backup_dead_ = other.backup_dead_;
+        backup_index_ = other.backup_index_;
+        rebuildStationIndexes();
+    }
+    return *this;
+}
+
+/**
+    * @return: A read-only iterator to the first station, equal to end() if there are none.
+*/
+StationManager::const_iterator StationManager::begin() const {
+    return LinkedList<KitchenStation*>::begin();
+}
+
+/**
+    * @return: The past-the-end read-only iterator.
+*/
+StationManager::const_iterator StationManager::end() const {
+    return LinkedList<KitchenStation*>::end();
+}
+
+/**
+    * Destructor
+    * @post: The stations stop notifying this station manager (the stations are not deallocated).
+*/
+StationManager::~StationManager() {
+    for (const auto& entry : station_order_) {
+        unwatchStation(entry.first);
+    }
+}
 
 // Member Functions
 /**
@@ -24,7 +83,14 @@ StationManager::StationManager() {}
     * @post: Inserts the station into the linked list.
 */
 bool StationManager::addStation(KitchenStation* station) {
-    return insert(item_count_, station);
+    Node<KitchenStation*>* node = insertAfter(getTailNode(), station);  // Append in O(1)
+    if (station != nullptr) {
+        indexStation(station->getName(), node);
+        station_order_[station] = ++back_order_;  // Last in the list
+        indexStationDishes(station);
+        watchStation(station);
+    }
+    return true;
 }
 
 /**
@@ -34,14 +100,29 @@ bool StationManager::addStation(KitchenStation* station) {
     * @return: True if the station was found and removed; false otherwise.
 */
 bool StationManager::removeStation(const std::string& station_name) {
-    // Iterate through each item in the station manager
-    for (int i = 0; i < item_count_; i++) {
-        // Check if the name of the station at the current index matches the input name
-        if (getEntry(i)->getName() == station_name) {
-            return remove(i);  // Remove the station at the found index
-        }
+    auto found = station_index_.find(station_name);
+    if (found == station_index_.end()) {
+        return false;  // Station not found
+    }
+    KitchenStation* station = found->second.node->getItem();
+    unlink(found->second.node);  // Remove the station's node in O(1)
+    unindexStation(station_name);
+    unindexStationDishes(station);
+    station_order_.erase(station);
+    unwatchStation(station);
+    return true;
+}
+
+/**
+    * Removes all stations from the station manager.
+    * @post: The list and its name, dish and order indexes are empty; the stations are not deallocated.
+*/
+void StationManager::clear() {
+    for (const auto& entry : station_order_) {
+        unwatchStation(entry.first);
     }
-    return false;  // Station not found
+    LinkedList<KitchenStation*>::clear();
+    rebuildStationIndexes();  // Empties them all
 }
 
 /**
@@ -50,15 +131,11 @@ bool StationManager::removeStation(const std::string& station_name) {
     * @return: A pointer to the KitchenStation if found; nullptr otherwise.
 */
 KitchenStation* StationManager::findStation(const std::string& station_name) const {
-    Node<KitchenStation*>* searchptr = getHeadNode();  // Start from the head node
-    while (searchptr != nullptr) {
-        // Check if the name of the station in the current node matches the input name
-        if (searchptr->getItem()->getName() == station_name) {
-            return searchptr->getItem();  // Return the station if found
-        }
-        searchptr = searchptr->getNext();  // Move to the next node
+    auto found = station_index_.find(station_name);  // Look the name up in the index
+    if (found == station_index_.end()) {
+        return nullptr;  // Station not found
     }
-    return nullptr;  // Station not found
+    return found->second.node->getItem();  // Return the station if found
 }
 
 /**
@@ -69,49 +146,184 @@ KitchenStation* StationManager::findStation(const std::string& station_name) con
 */
 bool StationManager::moveStationToFront(const std::string& station_name) {
     // First, make sure the station exists
-    if (findStation(station_name) == nullptr) {
+    auto found = station_index_.find(station_name);
+    if (found == station_index_.end()) {
         return false;
     }
-    
-    // If it's already at the front, return true
-    if (getHeadNode()->getItem()->getName() == station_name) {
-        return true;
+    // Relink the station's node at the front; the node (and so the name index) is unchanged
+    KitchenStation* station = found->second.node->getItem();
+    moveToFront(found->second.node);
+    // The station now comes first among the stations serving each of its dishes
+    unindexStationDishes(station);
+    station_order_[station] = --front_order_;
+    indexStationDishes(station);
+    return true;
+}
+
+/**
+    * Renames a station.
+    * @param station_name A string representing the station's current name.
+    * @param new_name A string representing the station's new name.
+    * @post: The station's name is updated, and so is the name index used to find it.
+    * @return: True if the station was found and renamed; false otherwise.
+*/
+bool StationManager::renameStation(const std::string& station_name, const std::string& new_name) {
+    auto found = station_index_.find(station_name);
+    if (found == station_index_.end()) {
+        return false;  // Station not found
     }
+    found->second.node->getItem()->setName(new_name);  // The station tells stationRenamed to re-index it
+    return true;
+}
 
-    Node<KitchenStation*>* searchptr = getHeadNode();
-    while (searchptr != nullptr) {
-        if (searchptr->getItem()->getName() == station_name) {
-            // Make a copy of the station
-            KitchenStation* station = searchptr->getItem();
-            
-            // Remove the station from its current position
-            int pos = getStationIndex(searchptr->getItem()->getName());
-            remove(pos);
-            
-            // Insert the station at the front
-            insert(0, station);
-            
-            return true;  // Exit after moving the station
+// helper function to rebuild the name, dish and order indexes from the list, front to back
+void StationManager::rebuildStationIndexes() {
+    station_index_.clear();
+    dish_stations_.clear();
+    station_order_.clear();
+    front_order_ = 0;
+    back_order_ = -1;
+    for (Node<KitchenStation*>* node = getHeadNode(); node != nullptr; node = node->getNext()) {
+        KitchenStation* station = node->getItem();
+        if (station != nullptr) {
+            indexStation(station->getName(), node);
+            station_order_[station] = ++back_order_;
+            indexStationDishes(station);
+            watchStation(station);
         }
-        
-        searchptr = searchptr->getNext();  // Move to the next node
     }
-    
-    return false;
 }
 
-// helper function to get index of a station by name
-int StationManager::getStationIndex(const std::string& name) const {
-    Node<KitchenStation*>* searchptr = getHeadNode();
-    int index = 0;
-    while (searchptr != nullptr) {
-        if (searchptr->getItem()->getName() == name) {
-            return index;
+// helper function to find the list node holding station: the name index points straight at it unless
+// other stations share its name, and only then is the list scanned
+Node<KitchenStation*>* StationManager::findStationNode(const KitchenStation* station, const std::string& station_name) const {
+    auto found = station_index_.find(station_name);
+    if (found == station_index_.end()) {
+        return nullptr;
+    }
+    if (found->second.node->getItem() == station) {
+        return found->second.node;
+    }
+    for (Node<KitchenStation*>* searchptr = getHeadNode(); searchptr != nullptr; searchptr = searchptr->getNext()) {
+        if (searchptr->getItem() == station) {
+            return searchptr;
+        }
+    }
+    return nullptr;
+}
+
+// helper function to have station notify this manager of renames and dish assignments
+void StationManager::watchStation(KitchenStation* station) {
+    std::vector<StationManager*>& managers = station->managers_;
+    if (std::find(managers.begin(), managers.end(), this) == managers.end()) {
+        managers.push_back(this);
+    }
+}
+
+// helper function to stop station notifying this manager
+void StationManager::unwatchStation(KitchenStation* station) {
+    std::vector<StationManager*>& managers = station->managers_;
+    managers.erase(std::remove(managers.begin(), managers.end(), this), managers.end());
+}
+
+// helper function to move a station renamed through KitchenStation::setName to its new name in the index
+void StationManager::stationRenamed(KitchenStation* station, const std::string& old_name) {
+    Node<KitchenStation*>* node = findStationNode(station, old_name);
+    if (node == nullptr) {
+        return;  // No longer in the list (e.g. after clear)
+    }
+    unindexStation(old_name);
+    indexStation(station->getName(), node);
+}
+
+// helper function to index a dish assigned through KitchenStation::assignDishToStation
+void StationManager::dishAssigned(KitchenStation* station, Dish* dish) {
+    if (station_order_.find(station) == station_order_.end()) {
+        return;  // No longer in the list (e.g. after clear)
+    }
+    indexDishAtStation(dish->getNameId(), station);
+}
+
+// helper function to drop a station that is being deallocated while still in the list
+void StationManager::stationDestroyed(KitchenStation* station) {
+    station_order_.erase(station);  // Never unwatch it again
+    Node<KitchenStation*>* node = findStationNode(station, station->getName());
+    if (node == nullptr) {
+        return;
+    }
+    unlink(node);
+    unindexStation(station->getName());
+    unindexStationDishes(station);
+}
+
+// helper function to add a station held by node to the name index
+void StationManager::indexStation(const std::string& name, Node<KitchenStation*>* node) {
+    auto found = station_index_.find(name);
+    if (found == station_index_.end()) {
+        station_index_.emplace(name, StationIndexEntry{node, 1});
+        return;
+    }
+    found->second.count++;
+    // Keep pointing at whichever node comes first in the list
+    for (Node<KitchenStation*>* searchptr = getHeadNode(); searchptr != nullptr; searchptr = searchptr->getNext()) {
+        if (searchptr == node || searchptr == found->second.node) {
+            found->second.node = searchptr;
+            return;
+        }
+    }
+}
+
+// helper function to add all dishes of a station to the dish index
+void StationManager::indexStationDishes(KitchenStation* station) {
+    for (Dish* dish : station->getDishes()) {
+        indexDishAtStation(dish->getNameId(), station);
+    }
+}
+
+// helper function to record that station serves the dish, keeping the dish's stations in list order
+void StationManager::indexDishAtStation(int dish_id, KitchenStation* station) {
+    std::vector<KitchenStation*>& stations = dish_stations_[dish_id];
+    long long order = station_order_[station];
+    auto position = std::lower_bound(stations.begin(), stations.end(), order,
+        [this](KitchenStation* candidate, long long key) { return station_order_[candidate] < key; });
+    stations.insert(position, station);
+}
+
+// helper function to drop all dishes of a station from the dish index
+void StationManager::unindexStationDishes(KitchenStation* station) {
+    for (Dish* dish : station->getDishes()) {
+        auto found = dish_stations_.find(dish->getNameId());
+        if (found == dish_stations_.end()) {
+            continue;
+        }
+        std::vector<KitchenStation*>& stations = found->second;
+        auto position = std::find(stations.begin(), stations.end(), station);
+        if (position != stations.end()) {
+            stations.erase(position);
+        }
+        if (stations.empty()) {
+            dish_stations_.erase(found);
+        }
+    }
+}
+
+// helper function to drop one station from the name index once it has been removed or renamed;
+// only when other stations share the name is the list scanned for the next one
+void StationManager::unindexStation(const std::string& name) {
+    auto found = station_index_.find(name);
+    if (found == station_index_.end()) {
+        return;
+    }
+    if (--found->second.count == 0) {
+        station_index_.erase(found);
+        return;
+    }
+    for (Node<KitchenStation*>* searchptr = getHeadNode(); searchptr != nullptr; searchptr = searchptr->getNext()) {
+        if (searchptr->getItem() != nullptr && searchptr->getItem()->getName() == name) {
+            found->second.node = searchptr;
+            return;
         }
-        searchptr = searchptr->getNext();
-        index++;
     }
-    return -1;
 }
 
 /**
@@ -119,15 +331,29 @@ int StationManager::getStationIndex(const std::string& name) const {
     * @param station_name1 The name of the first station.
     * @param station_name2 The name of the second station.
     * @post: The second station is removed from the list, and its contents are added to the first station.
+    * The first station owns the dishes it takes; the second keeps only those the first already had a dish of the same name for.
     * @return: True if both stations were found and merged; false otherwise.
 */
 bool StationManager::mergeStations(const std::string& station_name1, const std::string& station_name2) {
     KitchenStation* station1 = findStation(station_name1);
     KitchenStation* station2 = findStation(station_name2);
     if (station1 && station2) {
-        // take all the dishes from station2 and add them to station1
-        for (Dish* dish : station2->getDishes()) {
-            station1->assignDishToStation(dish);
+        // take all the dishes from station2 and hand them to station1, so only one station deletes each;
+        // every manager holding station2 re-indexes the dishes it keeps
+        for (StationManager* manager : station2->managers_) {
+            manager->unindexStationDishes(station2);
+        }
+        std::vector<Dish*> dishes;
+        dishes.swap(station2->dishes_);
+        station2->dish_index_.clear();
+        for (Dish* dish : dishes) {
+            if (!station1->assignDishToStation(dish)) {  // station1 tells dishAssigned to index it
+                station2->dishes_.push_back(dish);
+                station2->dish_index_.emplace(dish->getNameId(), dish);
+            }
+        }
+        for (StationManager* manager : station2->managers_) {
+            manager->indexStationDishes(station2);
         }
         // take all the ingredients from station2 and add them to station1
         for (Ingredient ingredient : station2->getIngredientsStock()) {
@@ -149,10 +375,8 @@ bool StationManager::mergeStations(const std::string& station_name1, const std::
 */
 bool StationManager::assignDishToStation(const std::string& station_name, Dish* dish) {
     KitchenStation* station = findStation(station_name);
-    if (station) {
-        return station->assignDishToStation(dish);
-    }
-    return false;
+    // The station tells dishAssigned to index the dish
+    return station && station->assignDishToStation(dish);
 }
 
 /**
@@ -177,12 +401,14 @@ bool StationManager::replenishIngredientAtStation(const std::string& station_nam
     * @return: True if any station can complete the order; false otherwise.
 */
 bool StationManager::canCompleteOrder(const std::string& dish_name) const {
-    Node<KitchenStation*>* searchptr = getHeadNode();
-    while (searchptr != nullptr) {
-        if (searchptr->getItem()->canCompleteOrder(dish_name)) {
+    auto found = dish_stations_.find(NameTable::find(dish_name));
+    if (found == dish_stations_.end()) {
+        return false;  // No station serves the dish
+    }
+    for (const KitchenStation* station : found->second) {
+        if (station->canCompleteOrder(found->first)) {
             return true;
         }
-        searchptr = searchptr->getNext();
     }
     return false;
 }
@@ -196,10 +422,8 @@ bool StationManager::canCompleteOrder(const std::string& dish_name) const {
 */
 bool StationManager::prepareDishAtStation(const std::string& station_name, const std::string& dish_name) {
     KitchenStation* station = findStation(station_name);
-    if (station && station->canCompleteOrder(dish_name)) {
-        return station->prepareDish(dish_name);
-    }
-    return false;
+    // prepareDish checks the ingredients itself, in the same pass that deducts them
+    return station && station->prepareDish(NameTable::find(dish_name));
 }
 
 // Accessors and Mutators
@@ -219,8 +443,15 @@ std::queue<Dish*> StationManager::getDishQueue() const{
     * @post: The list of backup ingredients is returned unchanged.
 */
 std::vector<Ingredient> StationManager::getBackupIngredients() const{
-    // Return a copy of the backup ingredients vector
-    return backup_ingredients_;
+    // Return a copy of the ingredients still in backup stock, in the order they were added
+    std::vector<Ingredient> backup_ingredients;
+    backup_ingredients.reserve(backup_ingredients_.size() - backup_dead_);
+    for (const BackupSlot& slot : backup_ingredients_) {
+        if (slot.in_stock) {
+            backup_ingredients.push_back(slot.ingredient);
+        }
+    }
+    return backup_ingredients;
 }
 
 /**
@@ -278,16 +509,16 @@ bool StationManager::prepareNextDish() {
 
     Dish* next_dish = dish_queue_.front();  // Get the next dish in the queue
 
-    // Attempt to prepare the dish at any station
-    for (int i = 0; i < getLength(); ++i) {
-        KitchenStation* station = getEntry(i);  // Get the station at the current index
-        // Check if the station can handle the dish
-        if (station->canCompleteOrder(next_dish->getName())) {
-            // Attempt to prepare the dish
-            if (station->prepareDish(next_dish->getName())) {
-                dish_queue_.pop();  // Remove the dish from the queue
-                return true;  // Dish was prepared successfully
-            }
+    auto found = dish_stations_.find(next_dish->getNameId());
+    if (found == dish_stations_.end()) {
+        return false;  // No station serves the dish
+    }
+    // Attempt to prepare the dish at the stations serving it, in list order
+    for (KitchenStation* station : found->second) {
+        // Attempt to prepare the dish; this fails without side effects if the station cannot handle it
+        if (station->prepareDish(next_dish->getNameId())) {
+            dish_queue_.pop();  // Remove the dish from the queue
+            return true;  // Dish was prepared successfully
         }
     }
     return false;  // Dish could not be prepared
@@ -340,31 +571,69 @@ bool StationManager::replenishStationIngredientFromBackup(const std::string& sta
     if (!station) {
         return false; // Station not found
     }
-    // Iterate through the backup ingredients to find the specified ingredient
-    for (auto it = backup_ingredients_.begin(); it != backup_ingredients_.end(); it++) {
-        // ingredient matches
-        if (it->name == ingredient_name) {
-            // there is enough quantity in the backup stock
-            if (it->quantity >= quantity) {
-                // Replenish the station's ingredient stock
-                Ingredient replenished_ingredient = *it;
-                replenished_ingredient.quantity = quantity;
-                station->replenishStationIngredients(replenished_ingredient);
-
-                // Decrease the quantity in the backup stock
-                it->quantity -= quantity;
-
-                // Remove the ingredient from backup stock if depleted
-                if (it->quantity == 0) {
-                    backup_ingredients_.erase(it);
-                }
-                return true; // Successfully replenished
-            } else {
-                return false; // Not enough quantity in backup stock
+    return transferFromBackup(station, NameTable::find(ingredient_name), quantity);
+}
+
+// helper function to move quantity of an ingredient from the backup stock to station
+bool StationManager::transferFromBackup(KitchenStation* station, int ingredient_id, int quantity) {
+    auto found = backup_index_.find(ingredient_id);
+    if (found == backup_index_.end()) {
+        return false; // Ingredient not found in backup stock
+    }
+    BackupSlot& slot = backup_ingredients_[found->second];
+    Ingredient& backup_ingredient = slot.ingredient;
+    // there is enough quantity in the backup stock
+    if (backup_ingredient.quantity < quantity) {
+        return false; // Not enough quantity in backup stock
+    }
+    // Replenish the station's ingredient stock
+    Ingredient replenished_ingredient = backup_ingredient;
+    replenished_ingredient.quantity = quantity;
+    station->replenishStationIngredients(replenished_ingredient);
+
+    // Decrease the quantity in the backup stock
+    backup_ingredient.quantity -= quantity;
+
+    // Remove the ingredient from backup stock if depleted: its slot goes dead and the next slot
+    // with the same ingredient, if any, takes over
+    if (backup_ingredient.quantity == 0) {
+        slot.in_stock = false;
+        backup_dead_++;
+        if (slot.next_same == NO_SLOT) {
+            backup_index_.erase(found);
+        } else {
+            found->second = slot.next_same;
+        }
+        // dead slots outnumbering live ones keeps compaction amortized O(1)
+        if (2 * backup_dead_ > backup_ingredients_.size()) {
+            rebuildBackupIndex();
+        }
+    }
+    return true; // Successfully replenished
+}
+
+// helper function to drop dead backup slots and rebuild backup_index_; with repeated names the first
+// slot wins, as in a front-to-back search, and links to the next one
+void StationManager::rebuildBackupIndex() {
+    size_t live = 0;
+    for (size_t i = 0; i < backup_ingredients_.size(); i++) {
+        if (backup_ingredients_[i].in_stock) {
+            if (live != i) {
+                backup_ingredients_[live] = std::move(backup_ingredients_[i]);
             }
+            live++;
         }
     }
-    return false; // Ingredient not found in backup stock
+    backup_ingredients_.resize(live);
+    backup_dead_ = 0;
+
+    // walk back to front so each slot links to the next one with its ID, and the index ends on the first
+    backup_index_.clear();
+    for (size_t i = live; i-- > 0;) {
+        auto placed = backup_index_.emplace(backup_ingredients_[i].ingredient.id, i);
+        backup_ingredients_[i].next_same = placed.second ? NO_SLOT : placed.first->second;
+        placed.first->second = i;
+    }
 }
 
 /**
@@ -376,7 +645,13 @@ bool StationManager::replenishStationIngredientFromBackup(const std::string& sta
 */
 bool StationManager::addBackupIngredients(const std::vector<Ingredient>& ingredients) {
     // Replace the current backup ingredients with the provided list
-    backup_ingredients_ = ingredients;
+    backup_ingredients_.clear();
+    backup_ingredients_.reserve(ingredients.size());
+    for (const Ingredient& ingredient : ingredients) {
+        backup_ingredients_.push_back(BackupSlot{ingredient, true, NO_SLOT});
+        backup_ingredients_.back().ingredient.id = NameTable::intern(ingredient.name);
+    }
+    rebuildBackupIndex();
     return true; // Ingredients were added
 }
 
@@ -389,13 +664,15 @@ bool StationManager::addBackupIngredients(const std::vector<Ingredient>& ingredi
     * @return True if the ingredient was added; false otherwise.
 */
 bool StationManager::addBackupIngredient(const Ingredient& ingredient) {
-    for (auto& backup_ingredient : backup_ingredients_) {
-        if (backup_ingredient.name == ingredient.name) {
-            backup_ingredient.quantity += ingredient.quantity;  // Increase quantity if ingredient exists
-            return true;  // Ingredient was added
-        }
+    int ingredient_id = NameTable::intern(ingredient.name);
+    auto found = backup_index_.find(ingredient_id);
+    if (found != backup_index_.end()) {
+        backup_ingredients_[found->second].ingredient.quantity += ingredient.quantity;  // Increase quantity if ingredient exists
+        return true;  // Ingredient was added
     }
-    backup_ingredients_.push_back(ingredient);  // Add new ingredient if it doesn't exist
+    backup_index_.emplace(ingredient_id, backup_ingredients_.size());
+    backup_ingredients_.push_back(BackupSlot{ingredient, true, NO_SLOT});  // Add new ingredient if it doesn't exist
+    backup_ingredients_.back().ingredient.id = ingredient_id;
     return true;  // Ingredient was added
 }
 
@@ -406,6 +683,8 @@ bool StationManager::addBackupIngredient(const Ingredient& ingredient) {
 void StationManager::clearBackupIngredients(){
     // Clear all elements from the backup ingredients vector
     backup_ingredients_.clear();
+    backup_dead_ = 0;
+    backup_index_.clear();
 }
 
 /**
@@ -431,8 +710,7 @@ void StationManager::processAllDishes() {
         std::cout << "PREPARING DISH: " << dishToPrepare->getName() << std::endl;
 
         // Iterate through all kitchen stations to find one that can prepare the dish
-        for (int i = 0; i < getLength(); i++) {
-            KitchenStation* station = getEntry(i);  // Get the current station
+        for (KitchenStation* station : *this) {
             // Check if the station is valid
             if (!station || station->getName().empty()) {
                 continue;  // Skip invalid station
@@ -440,50 +718,40 @@ void StationManager::processAllDishes() {
             std::cout << station->getName() << " attempting to prepare " << dishToPrepare->getName() << "..." << std::endl;
 
             // Check if the station has the dish
-            bool dishAvailable = false;
-            for (Dish* item : station->getDishes()) {
-                if (item->getName() == dishToPrepare->getName()) {
-                    dishAvailable = true;  // Dish is available at this station
-                    break;
-                }
-            }
-            if (!dishAvailable) {
+            if (!station->hasDish(dishToPrepare->getNameId())) {
                 std::cout << station->getName() << ": Dish not available. Moving to next station..." << std::endl;
                 continue;  // Move to the next station if dish is not available
             }
 
             // Check if the station can complete the order
-            if (!station->canCompleteOrder(dishToPrepare->getName())) {
+            if (!station->canCompleteOrder(dishToPrepare->getNameId())) {
                 std::cout << station->getName() << ": Insufficient ingredients. Replenishing ingredients..." << std::endl;
 
                 bool replenished = true;  // Track if ingredients were successfully replenished
                 // Iterate over the ingredients needed for the dish and replenish as necessary
                 for (const Ingredient& ingredient : dishToPrepare->getIngredients()) {
-                    bool ingredientFound = false;  // Track if the ingredient is found in stock
                     int requiredQuantity = ingredient.required_quantity;  // Quantity needed
                     int availableQuantity = 0;  // Quantity available in stock
 
                     // Check if the ingredient exists in the station's stock and how much is available
-                    for (Ingredient& stockIngredient : station->getIngredientsStock()) {
-                        if (ingredient.name == stockIngredient.name) {
-                            availableQuantity = stockIngredient.quantity;  // Update available quantity
-                            ingredientFound = true;  // Ingredient found in stock
-                            break;
-                        }
+                    const Ingredient* stockIngredient = station->findStockIngredient(ingredient.id);
+                    bool ingredientFound = (stockIngredient != nullptr);  // Track if the ingredient is found in stock
+                    if (ingredientFound) {
+                        availableQuantity = stockIngredient->quantity;  // Update available quantity
                     }
 
                     if (ingredientFound) {
                         // If the available quantity is less than required, calculate the difference
                         int diff = requiredQuantity - availableQuantity;
                         if (diff > 0) { // Replenish the missing quantity from backup 
-                            if (!replenishStationIngredientFromBackup(station->getName(), ingredient.name, diff)) {
+                            if (!transferFromBackup(station, ingredient.id, diff)) {
                                 replenished = false;
                                 break;
                             }
                         }
                     } else {
                         // If the ingredient is not found at all, replenish the full required quantity
-                        if (!replenishStationIngredientFromBackup(station->getName(), ingredient.name, requiredQuantity)) {
+                        if (!transferFromBackup(station, ingredient.id, requiredQuantity)) {
                             replenished = false;  // Replenishment failed
                             break;
                         }
@@ -498,7 +766,7 @@ void StationManager::processAllDishes() {
             }
 
             // Attempt to prepare the dish after replenishment
-            if (station->prepareDish(dishToPrepare->getName())) {
+            if (station->prepareDish(dishToPrepare->getNameId())) {
                 std::cout << station->getName() << ": Successfully prepared " << dishToPrepare->getName() << "." << std::endl;
                 prepared = true;  // Dish was successfully prepared
                 break;
@@ -516,3 +784,198 @@ void StationManager::processAllDishes() {
     dish_queue_ = temp_queue; // Replace the original queue with the new one
     std::cout << "\nAll dishes have been processed." << std::endl;
 }
+
+/**
+    * Processes all dishes in the queue in batch: replenishment is planned for the whole queue up front.
+    * @pre: None.
+    * @post: The dishes are planned in queue order against a model of the station and backup stock: each
+    * goes to the first station serving it (in list order) that can make it as stocked, or once its
+    * shortfall is topped up from the backup, where a top-up is only planned if the backup covers the
+    * whole dish. Each planned station then receives its top-ups in one consolidated transfer, and the
+    * planned dishes are prepared in queue order. No stock is moved for a dish that is not prepared.
+    * Unprepared dishes stay in the queue in their original order, as in processAllDishes.
+*/
+void StationManager::processAllDishesBatched() {
+    // Take the valid dishes off the queue, in order
+    std::vector<Dish*> dishes;
+    dishes.reserve(dish_queue_.size());
+    while (!dish_queue_.empty()) {
+        Dish* dish = dish_queue_.front();
+        dish_queue_.pop();
+        if (dish && !dish->getName().empty()) {
+            dishes.push_back(dish);  // Invalid dishes are dropped, as in processAllDishes
+        }
+    }
+
+    // Model of the stock, loaded as ingredients come up: per station the stock of each ingredient,
+    // and per ingredient the backup slot in use (NO_SLOT once none is left) and what it has left
+    struct ModelStock {
+        bool in_stock;
+        int quantity;
+    };
+    std::unordered_map<KitchenStation*, std::unordered_map<int, ModelStock>> station_stock;
+    std::unordered_map<int, std::pair<size_t, int>> backup_stock;
+    // Top-ups planned for one station: (ingredient ID, total quantity), in the order ingredients first come up
+    struct StationTopUp {
+        KitchenStation* station;
+        std::vector<std::pair<int, int>> ingredients;
+        std::unordered_map<int, size_t> positions;  // ingredient ID -> position in ingredients
+    };
+    std::vector<StationTopUp> top_ups;
+    std::unordered_map<KitchenStation*, size_t> top_up_positions;  // station -> position in top_ups
+    std::vector<KitchenStation*> planned(dishes.size(), nullptr);  // station each dish is planned at
+
+    // Model entries changed by the current trial and their previous values, to undo a trial that fails
+    std::vector<std::pair<ModelStock*, ModelStock>> stock_undo;
+    std::vector<std::pair<std::pair<size_t, int>*, std::pair<size_t, int>>> backup_undo;
+    std::vector<std::pair<int, int>> trial_transfers;  // (ingredient ID, quantity) the current trial moves
+
+    // Plan: try each dish at the stations serving it, in list order
+    for (size_t i = 0; i < dishes.size(); i++) {
+        int dish_id = dishes[i]->getNameId();
+        auto serving = dish_stations_.find(dish_id);
+        if (serving == dish_stations_.end()) {
+            continue;  // No station serves the dish
+        }
+        for (KitchenStation* station : serving->second) {
+            // The station makes its own assigned dish, so plan with that dish's ingredients
+            const Dish* assigned = station->findDish(dish_id);
+            if (assigned == nullptr) {
+                continue;
+            }
+            const std::vector<Ingredient>& ingredients = assigned->getIngredients();
+            std::unordered_map<int, ModelStock>& stock = station_stock[station];
+            bool makeable = true;
+            for (const Ingredient& ingredient : ingredients) {
+                auto modeled = stock.find(ingredient.id);
+                if (modeled == stock.end()) {
+                    const Ingredient* stocked = station->findStockIngredient(ingredient.id);
+                    modeled = stock.emplace(ingredient.id, ModelStock{stocked != nullptr, stocked ? stocked->quantity : 0}).first;
+                }
+                const ModelStock& have = modeled->second;
+                if (!have.in_stock || have.quantity < ingredient.required_quantity || have.quantity < ingredient.quantity) {
+                    makeable = false;
+                }
+            }
+
+            // Top up what the station lacks, as processAllDishes would, only if the backup covers all of it
+            stock_undo.clear();
+            backup_undo.clear();
+            trial_transfers.clear();
+            bool covered = true;
+            if (!makeable) {
+                for (const Ingredient& ingredient : ingredients) {
+                    int needed = std::max(ingredient.required_quantity, ingredient.quantity);
+                    ModelStock& have = stock[ingredient.id];
+                    if (have.in_stock && have.quantity >= needed) {
+                        continue;
+                    }
+                    int move = have.in_stock ? needed - have.quantity : needed;
+
+                    auto backed = backup_stock.find(ingredient.id);
+                    if (backed == backup_stock.end()) {
+                        auto indexed = backup_index_.find(ingredient.id);
+                        size_t slot = (indexed == backup_index_.end()) ? NO_SLOT : indexed->second;
+                        int left = (slot == NO_SLOT) ? 0 : backup_ingredients_[slot].ingredient.quantity;
+                        backed = backup_stock.emplace(ingredient.id, std::make_pair(slot, left)).first;
+                    }
+                    std::pair<size_t, int>& backup = backed->second;
+                    if (backup.first == NO_SLOT || backup.second < move) {
+                        covered = false;  // The backup cannot cover the dish here; undone below
+                        break;
+                    }
+                    backup_undo.push_back(std::make_pair(&backup, backup));
+                    backup.second -= move;
+                    if (backup.second == 0) {
+                        // Used up: the next slot with this ingredient, if any, takes over, as in transferFromBackup
+                        backup.first = backup_ingredients_[backup.first].next_same;
+                        backup.second = (backup.first == NO_SLOT) ? 0 : backup_ingredients_[backup.first].ingredient.quantity;
+                    }
+                    stock_undo.push_back(std::make_pair(&have, have));
+                    have.quantity = (have.in_stock ? have.quantity : 0) + move;
+                    have.in_stock = true;
+                    trial_transfers.push_back(std::make_pair(ingredient.id, move));
+                }
+            }
+            if (!covered) {
+                for (size_t j = stock_undo.size(); j-- > 0;) {
+                    *stock_undo[j].first = stock_undo[j].second;
+                }
+                for (size_t j = backup_undo.size(); j-- > 0;) {
+                    *backup_undo[j].first = backup_undo[j].second;
+                }
+                continue;  // Move to the next station
+            }
+
+            // Topped up (or already stocked), the dish can be made here.
+            // Deduct as tryPrepareDish does: an ingredient used up is gone for a repeat of it later in the list
+            for (const Ingredient& ingredient : ingredients) {
+                ModelStock& have = stock[ingredient.id];
+                if (have.in_stock) {
+                    have.quantity -= ingredient.required_quantity;
+                    have.in_stock = (have.quantity != 0);
+                }
+            }
+            if (!trial_transfers.empty()) {
+                auto placed = top_up_positions.emplace(station, top_ups.size());
+                if (placed.second) {
+                    top_ups.push_back(StationTopUp{station, {}, {}});
+                }
+                StationTopUp& top_up = top_ups[placed.first->second];
+                for (const std::pair<int, int>& transfer : trial_transfers) {
+                    auto listed = top_up.positions.emplace(transfer.first, top_up.ingredients.size());
+                    if (listed.second) {
+                        top_up.ingredients.push_back(std::make_pair(transfer.first, 0));
+                    }
+                    top_up.ingredients[listed.first->second].second += transfer.second;
+                }
+            }
+            planned[i] = station;
+            break;
+        }
+    }
+
+    // Transfer: one consolidated top-up per station; a total the first backup slot cannot hold
+    // is drawn from the next slots with the same ingredient, as the plan did
+    for (const StationTopUp& top_up : top_ups) {
+        for (const std::pair<int, int>& needed : top_up.ingredients) {
+            int remaining = needed.second;
+            do {
+                auto backup = backup_index_.find(needed.first);
+                if (backup == backup_index_.end()) {
+                    break;
+                }
+                int drawn = std::min(remaining, backup_ingredients_[backup->second].ingredient.quantity);
+                transferFromBackup(top_up.station, needed.first, drawn);
+                remaining -= drawn;
+            } while (remaining > 0);
+        }
+        std::cout << top_up.station->getName() << ": Ingredients replenished." << std::endl;
+    }
+
+    // Prepare in queue order at the planned stations; dishes that cannot be made go back on the queue in order
+    for (size_t i = 0; i < dishes.size(); i++) {
+        Dish* dish = dishes[i];
+        bool prepared = false;
+        if (planned[i]) {
+            prepared = planned[i]->prepareDish(dish->getNameId());
+            // A dish listing an ingredient twice can use more of it from a fuller stock than the plan
+            // counted; fall back to the other stations serving it
+            auto serving = dish_stations_.find(dish->getNameId());
+            for (size_t j = 0; !prepared && serving != dish_stations_.end() && j < serving->second.size(); j++) {
+                KitchenStation* station = serving->second[j];
+                if (station != planned[i] && station->prepareDish(dish->getNameId())) {
+                    planned[i] = station;
+                    prepared = true;
+                }
+            }
+        }
+        if (prepared) {
+            std::cout << planned[i]->getName() << ": Successfully prepared " << dish->getName() << "." << std::endl;
+        } else {
+            std::cout << dish->getName() << " was not prepared." << std::endl;
+            dish_queue_.push(dish);  // Requeue the unprepared dish
+        }
+    }
+    std::cout << "\nAll dishes have been processed." << std::endl;
+}
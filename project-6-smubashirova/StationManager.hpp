@@ -16,16 +16,57 @@
 #include <string>
 #include <queue>  //std::queue, push, pop, front
 #include <vector> //std::vector, push_back
+#include <unordered_map> //std::unordered_map, find, emplace, erase
 
-// StationManager class inherits from LinkedList to manage KitchenStation objects
-class StationManager : public LinkedList<KitchenStation*> {
+// StationManager class inherits from LinkedList to manage KitchenStation objects.
+// The inheritance is private so the list only changes through StationManager's own functions,
+// which keep its name, dish and order indexes current; only the read-only list members are public.
+class StationManager : private LinkedList<KitchenStation*> {
 public:
+    using LinkedList<KitchenStation*>::const_iterator;
+    using LinkedList<KitchenStation*>::isEmpty;
+    using LinkedList<KitchenStation*>::getLength;
+    using LinkedList<KitchenStation*>::getEntry;
+    using LinkedList<KitchenStation*>::getNodeAllocator;
+
+    /**
+     * @return: A read-only iterator to the first station, equal to end() if there are none.
+    */
+    const_iterator begin() const;
+
+    /**
+     * @return: The past-the-end read-only iterator.
+    */
+    const_iterator end() const;
+
     /**
      * Default Constructor
      * @post: Initializes an empty station manager.
     */
     StationManager();
 
+    /**
+     * Copy Constructor
+     * @param other The station manager to copy.
+     * @post: Holds the same station pointers, dish queue and backup stock as other, with its own
+     * name, dish and order indexes rebuilt over its own list nodes.
+    */
+    StationManager(const StationManager& other);
+
+    /**
+     * Copy Assignment Operator
+     * @param other The station manager to copy.
+     * @post: Same as the copy constructor; the previous list nodes are freed (the stations are not).
+     * @return: A reference to this station manager.
+    */
+    StationManager& operator=(const StationManager& other);
+
+    /**
+     * Destructor
+     * @post: The stations stop notifying this station manager (the stations are not deallocated).
+    */
+    ~StationManager();
+
     // Member Functions
     /**
      * Adds a new station to the station manager.
@@ -42,6 +83,12 @@ public:
     */
     bool removeStation(const std::string& station_name);
 
+    /**
+     * Removes all stations from the station manager.
+     * @post: The list and its name, dish and order indexes are empty; the stations are not deallocated.
+    */
+    void clear();
+
     /**
      * Finds a station in the station manager by name.
      * @param station_name A string representing the station's name.
@@ -57,11 +104,21 @@ public:
     */
     bool moveStationToFront(const std::string& station_name);
 
+    /**
+     * Renames a station.
+     * @param station_name A string representing the station's current name.
+     * @param new_name A string representing the station's new name.
+     * @post: The station's name is updated, and so is the name index used to find it.
+     * @return: True if the station was found and renamed; false otherwise.
+    */
+    bool renameStation(const std::string& station_name, const std::string& new_name);
+
     /**
      * Merges the dishes and ingredients of two specified stations.
      * @param station_name1 The name of the first station.
      * @param station_name2 The name of the second station.
      * @post: The second station is removed from the list, and its contents are added to the first station.
+     * The first station owns the dishes it takes; the second keeps only those the first already had a dish of the same name for.
      * @return: True if both stations were found and merged; false otherwise.
     */
     bool mergeStations(const std::string& station_name1, const std::string& station_name2);
@@ -211,13 +268,80 @@ public:
     */
     void processAllDishes();
 
+    /**
+     * Processes all dishes in the queue in batch: replenishment is planned for the whole queue up front.
+     * @pre: None.
+     * @post: The dishes are planned in queue order against a model of the station and backup stock: each
+     * goes to the first station serving it (in list order) that can make it as stocked, or once its
+     * shortfall is topped up from the backup, where a top-up is only planned if the backup covers the
+     * whole dish. Each planned station then receives its top-ups in one consolidated transfer, reported
+     * as "<station>: Ingredients replenished.", and the planned dishes are prepared in queue order,
+     * reporting "<station>: Successfully prepared <dish>." or "<dish> was not prepared.".
+     * No stock is moved for a dish that is not prepared, so backup stock is never stranded at a station
+     * that still cannot make the dish. Unprepared dishes stay in the queue in their original order, as in
+     * processAllDishes.
+    */
+    void processAllDishesBatched();
+
 private:
-    // helper function to get index of a station by name
-    int getStationIndex(const std::string& station_name) const;
+    // helper function to rebuild the name, dish and order indexes from the list
+    void rebuildStationIndexes();
+    // helper functions to add/drop one station to/from the name index
+    void indexStation(const std::string& station_name, Node<KitchenStation*>* node);
+    void unindexStation(const std::string& station_name);
+    // Entry of the name index: the node holding the first station with a name, and how many stations share it
+    struct StationIndexEntry {
+        Node<KitchenStation*>* node;
+        int count;
+    };
+    // Index from station name to its list node, so stations are found without scanning the list.
+    // Kept in sync by addStation, removeStation and moveStationToFront, and by stationRenamed,
+    // which KitchenStation::setName calls however the station is renamed.
+    std::unordered_map<std::string, StationIndexEntry> station_index_;
+    // helper function to find the list node holding station, known to be named station_name
+    Node<KitchenStation*>* findStationNode(const KitchenStation* station, const std::string& station_name) const;
+    // helper functions to add/drop this manager to/from a station's managers_
+    void watchStation(KitchenStation* station);
+    void unwatchStation(KitchenStation* station);
+    // called by KitchenStation::setName on a station this manager watches
+    void stationRenamed(KitchenStation* station, const std::string& old_name);
+    // called by ~KitchenStation on a station this manager watches: drops it from the list and indexes
+    void stationDestroyed(KitchenStation* station);
+    friend class KitchenStation;
+    // helper functions to add/drop a station's dishes to/from the dish index
+    void indexStationDishes(KitchenStation* station);
+    void indexDishAtStation(int dish_id, KitchenStation* station);
+    void unindexStationDishes(KitchenStation* station);
+    // Reverse index from dish name ID to the stations that have the dish assigned, each list kept
+    // in station list order, so dispatch only looks at candidate stations.
+    // Kept in sync by addStation, removeStation and moveStationToFront, and by dishAssigned, which KitchenStation::assignDishToStation calls however the dish is assigned.
+    std::unordered_map<int, std::vector<KitchenStation*>> dish_stations_;
+    // called by KitchenStation::assignDishToStation on a station this manager watches
+    void dishAssigned(KitchenStation* station, Dish* dish);
+    // Position key of each station: smaller keys come first in the list. Its keys are also the
+    // stations this manager watches.
+    std::unordered_map<KitchenStation*, long long> station_order_;
+    long long front_order_; // key of the station at the front of the list
+    long long back_order_;  // key of the station at the back of the list
     // Queue to manage dishes in FIFO order
     std::queue<Dish*> dish_queue_;
-    // Backup stock of ingredients
-    std::vector<Ingredient> backup_ingredients_; 
+    // Backup stock slots in the order ingredients were added; a used-up ingredient leaves a dead
+    // slot until the next compaction, and getBackupIngredients skips it
+    struct BackupSlot {
+        Ingredient ingredient;
+        bool in_stock;
+        size_t next_same;  // position of the next slot with the same ingredient ID, NO_SLOT if none
+    };
+    static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+    std::vector<BackupSlot> backup_ingredients_;
+    size_t backup_dead_;  // number of dead slots in backup_ingredients_
+    // Index from interned ingredient ID to its first live slot in backup_ingredients_
+    std::unordered_map<int, size_t> backup_index_;
+    // helper function to drop dead backup slots and rebuild backup_index_ and the next_same links
+    void rebuildBackupIndex();
+    // helper function to move quantity of an ingredient from the backup stock to station;
+    // fails without changes if the backup holds less than quantity
+    bool transferFromBackup(KitchenStation* station, int ingredient_id, int quantity);
 };
 
 #endif // STATIONMANAGER_HPP
\ No newline at end of file
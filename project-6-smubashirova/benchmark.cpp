@@ -0,0 +1,490 @@
+//  Assignment: Project 6
+//  Description: This program times building a list of 100k stations and
+//  churning it with moveStationToFront and removeStation, times dispatching
+//  10k dishes over 1k stations with prepareNextDish and processAllDishes
+//  against a sweep of the list by getEntry, times stocking, finding and
+//  preparing from a station with 5k ingredients, times the per-order cost
+//  of tryPrepareDish and prepareDishAtStation against checking with
+//  canCompleteOrder before preparing, and times processAllDishes against processAllDishesBatched on a queue of 100k
+//  dishes over 20 stations, with ample and with scarce backup stock, and
+//  reports how many dishes each leaves unprepared.
+
+#include "StationManager.hpp"
+#include "KitchenStation.hpp"
+#include "Dessert.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Milliseconds taken by one call of work
+template <class Work>
+double timeMs(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Discards everything written to it, so the per-dish report does not dominate the timings
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+const int STATIONS = 20;
+const int DISHES = 400;            // each served by two neighbouring stations
+const int INGREDIENTS = 60;
+const int DISH_INGREDIENTS = 6;
+const int QUEUED = 100000;
+
+// A dish name for number n; dish names may only hold letters and spaces, so n is spelled in base 26
+std::string dishName(int n) {
+    std::string letters;
+    do {
+        letters.insert(letters.begin(), static_cast<char>('A' + n % 26));
+        n /= 26;
+    } while (n > 0);
+    return "Dish " + letters;
+}
+
+// A kitchen built the same way from the same seed, owning its stations and queued orders
+struct Kitchen {
+    StationManager manager;
+    std::vector<KitchenStation*> stations;
+    std::vector<Dish*> orders;
+
+    Kitchen(int backup_per_ingredient) {
+        std::mt19937 rng(235);
+        std::vector<std::vector<Ingredient>> recipes(DISHES);
+        for (std::vector<Ingredient>& recipe : recipes) {
+            std::vector<int> picked;
+            while (static_cast<int>(picked.size()) < DISH_INGREDIENTS) {
+                int ingredient = static_cast<int>(rng() % INGREDIENTS);
+                bool repeated = false;
+                for (int other : picked) {
+                    repeated = repeated || other == ingredient;
+                }
+                if (!repeated) {
+                    picked.push_back(ingredient);
+                    recipe.push_back(Ingredient("Ingredient " + std::to_string(ingredient), 0, 1 + static_cast<int>(rng() % 3), 1.0));
+                }
+            }
+        }
+        for (int s = 0; s < STATIONS; s++) {
+            KitchenStation* station = new KitchenStation("Station " + std::to_string(s));
+            int per_station = DISHES / STATIONS;
+            // this station's own dishes, and the previous station's as its fallback
+            for (int first : {s * per_station, ((s + STATIONS - 1) % STATIONS) * per_station}) {
+                for (int d = first; d < first + per_station; d++) {
+                    Dish* dish = new Dessert();
+                    dish->setName(dishName(d));
+                    dish->setIngredients(recipes[d]);
+                    station->assignDishToStation(dish);
+                }
+            }
+            for (int i = 0; i < INGREDIENTS; i++) {
+                station->replenishStationIngredients(Ingredient("Ingredient " + std::to_string(i), 50, 0, 1.0));
+            }
+            manager.addStation(station);
+            stations.push_back(station);
+        }
+        std::vector<Ingredient> backup;
+        for (int i = 0; i < INGREDIENTS; i++) {
+            backup.push_back(Ingredient("Ingredient " + std::to_string(i), backup_per_ingredient, 0, 1.0));
+        }
+        manager.addBackupIngredients(backup);
+        for (int i = 0; i < QUEUED; i++) {
+            int d = static_cast<int>(rng() % DISHES);
+            Dish* order = new Dessert();
+            order->setName(dishName(d));
+            order->setIngredients(recipes[d]);
+            orders.push_back(order);
+            manager.addDishToQueue(order);
+        }
+    }
+    ~Kitchen() {
+        for (KitchenStation* station : stations) {
+            delete station;
+        }
+        for (Dish* order : orders) {
+            delete order;
+        }
+    }
+};
+
+// Builds a list of 100k stations with addStation, moves random stations to the front, then removes random
+// stations and adds them back; true if the list still holds every station and the last one moved is where it should be
+bool benchmarkStationChurn() {
+    const int n = 100000;
+    std::vector<std::string> names;
+    std::vector<KitchenStation*> stations;
+    for (int i = 0; i < n; i++) {
+        names.push_back("Station " + std::to_string(i));
+        stations.push_back(new KitchenStation(names.back()));
+    }
+    std::mt19937 rng(235);
+    std::vector<int> picks;
+    for (int i = 0; i < n; i++) {
+        picks.push_back(static_cast<int>(rng() % n));
+    }
+
+    StationManager manager;
+    double build_ms = timeMs([&] {
+        for (KitchenStation* station : stations) {
+            manager.addStation(station);
+        }
+    });
+    double move_ms = timeMs([&] {
+        for (int pick : picks) {
+            manager.moveStationToFront(names[pick]);
+        }
+    });
+    bool moved = manager.getEntry(0) == stations[picks.back()];
+    int removed = 0;
+    double remove_ms = timeMs([&] {
+        for (int pick : picks) {
+            if (manager.removeStation(names[pick]) && manager.addStation(stations[pick])) {
+                removed++;
+            }
+        }
+    });
+    std::cout << n << " stations: addStation " << build_ms << " ms, moveStationToFront x" << n << " " << move_ms
+              << " ms, removeStation and addStation x" << removed << " " << remove_ms << " ms" << std::endl;
+
+    bool ok = moved && removed == n && manager.getLength() == n && manager.getEntry(n - 1) == stations[picks.back()];
+    for (int i = 0; i < n; i += 997) {
+        ok = ok && manager.findStation(names[i]) == stations[i];
+    }
+    manager.clear();
+    for (KitchenStation* station : stations) {
+        delete station;
+    }
+    return ok;
+}
+
+const int DISPATCH_STATIONS = 1000;
+const int DISPATCH_QUEUED = 10000;
+
+// 1k stations each serving its own dish, and a queue of orders for random dishes, built the same way from the same seed
+struct DispatchKitchen {
+    StationManager manager;
+    std::vector<KitchenStation*> stations;
+    std::vector<Dish*> orders;
+    std::vector<int> ordered;   // orders per station
+
+    DispatchKitchen() : ordered(DISPATCH_STATIONS, 0) {
+        for (int s = 0; s < DISPATCH_STATIONS; s++) {
+            KitchenStation* station = new KitchenStation("Station " + std::to_string(s));
+            Dish* dish = new Dessert();
+            dish->setName(dishName(s));
+            dish->setIngredients({Ingredient("Ingredient " + std::to_string(s), 0, 1, 1.0)});
+            station->assignDishToStation(dish);
+            station->replenishStationIngredients(Ingredient("Ingredient " + std::to_string(s), DISPATCH_QUEUED, 0, 1.0));
+            manager.addStation(station);
+            stations.push_back(station);
+        }
+        std::mt19937 rng(235);
+        for (int i = 0; i < DISPATCH_QUEUED; i++) {
+            int s = static_cast<int>(rng() % DISPATCH_STATIONS);
+            Dish* order = new Dessert();
+            order->setName(dishName(s));
+            order->setIngredients({Ingredient("Ingredient " + std::to_string(s), 0, 1, 1.0)});
+            orders.push_back(order);
+            ordered[s]++;
+            manager.addDishToQueue(order);
+        }
+    }
+    ~DispatchKitchen() {
+        for (KitchenStation* station : stations) {
+            delete station;
+        }
+        for (Dish* order : orders) {
+            delete order;
+        }
+    }
+
+    // True if the queue is empty and each station used one unit of stock per order for its dish
+    bool allPrepared() const {
+        bool ok = manager.getDishQueue().empty();
+        for (int s = 0; s < DISPATCH_STATIONS; s++) {
+            const Ingredient* stock = stations[s]->findStockIngredient("Ingredient " + std::to_string(s));
+            ok = ok && stock != nullptr && stock->quantity == DISPATCH_QUEUED - ordered[s];
+        }
+        return ok;
+    }
+};
+
+// Dispatches the same queue with prepareNextDish and with processAllDishes, and times finding each order's
+// station by a sweep of the list with getEntry(i), as dispatch used to, against a sweep with the iterators;
+// true if both dispatches prepare every order at its station and both sweeps find the same stations
+bool benchmarkDispatch() {
+    DispatchKitchen next_dish, all_dishes;
+    NullBuffer discarded;
+    std::streambuf* console = std::cout.rdbuf(&discarded);
+    double next_dish_ms = timeMs([&] {
+        while (next_dish.manager.prepareNextDish()) {
+        }
+    });
+    double all_dishes_ms = timeMs([&] { all_dishes.manager.processAllDishes(); });
+    std::cout.rdbuf(console);
+
+    const int sweeps = 200;
+    const StationManager& manager = next_dish.manager;
+    long by_entry = 0, by_iterator = 0;
+    double entry_ms = timeMs([&] {
+        for (int i = 0; i < sweeps; i++) {
+            int dish_id = next_dish.orders[i]->getNameId();
+            for (int position = 0; position < manager.getLength(); position++) {
+                if (manager.getEntry(position)->hasDish(dish_id)) {
+                    by_entry += position;
+                    break;
+                }
+            }
+        }
+    });
+    double iterator_ms = timeMs([&] {
+        for (int i = 0; i < sweeps; i++) {
+            int dish_id = next_dish.orders[i]->getNameId();
+            int position = 0;
+            for (KitchenStation* station : manager) {
+                if (station->hasDish(dish_id)) {
+                    by_iterator += position;
+                    break;
+                }
+                position++;
+            }
+        }
+    });
+    std::cout << DISPATCH_QUEUED << " dishes over " << DISPATCH_STATIONS << " stations: prepareNextDish "
+              << next_dish_ms << " ms, processAllDishes " << all_dishes_ms << " ms; finding a station by sweep: getEntry(i) "
+              << entry_ms * 1000 / sweeps << " us, iterators " << iterator_ms * 1000 / sweeps << " us" << std::endl;
+    return next_dish.allPrepared() && all_dishes.allPrepared() && by_entry == by_iterator;
+}
+
+const int SKUS = 5000;
+const int SKU_DISHES = 200;
+const int SKU_DISH_INGREDIENTS = 8;
+const int SKU_ORDERS = 100000;
+
+// Stocks one station with 5k ingredients, then times restocking them, finding each by name against a linear
+// scan of getIngredientsStock, and checking and preparing 100k orders; true if the station's stock ends
+// at the quantities worked out from the orders
+bool benchmarkLargeStock() {
+    std::vector<std::string> skus;
+    for (int i = 0; i < SKUS; i++) {
+        skus.push_back("Ingredient " + std::to_string(i));
+    }
+    std::mt19937 rng(235);
+    KitchenStation station("Pantry");
+    std::vector<int> dish_ids;
+    std::vector<std::vector<int>> recipes(SKU_DISHES);
+    for (int d = 0; d < SKU_DISHES; d++) {
+        std::vector<Ingredient> recipe;
+        while (static_cast<int>(recipes[d].size()) < SKU_DISH_INGREDIENTS) {
+            int sku = static_cast<int>(rng() % SKUS);
+            bool repeated = false;
+            for (int other : recipes[d]) {
+                repeated = repeated || other == sku;
+            }
+            if (!repeated) {
+                recipes[d].push_back(sku);
+                recipe.push_back(Ingredient(skus[sku], 0, 1, 1.0));
+            }
+        }
+        Dish* dish = new Dessert();
+        dish->setName(dishName(d));
+        dish->setIngredients(recipe);
+        station.assignDishToStation(dish);
+        dish_ids.push_back(dish->getNameId());
+    }
+
+    double stock_ms = timeMs([&] {
+        for (const std::string& sku : skus) {
+            station.replenishStationIngredients(Ingredient(sku, SKU_ORDERS, 0, 1.0));
+        }
+    });
+    double restock_ms = timeMs([&] {
+        for (const std::string& sku : skus) {
+            station.replenishStationIngredients(Ingredient(sku, SKU_ORDERS, 0, 1.0));
+        }
+    });
+    int found = 0;
+    double find_ms = timeMs([&] {
+        for (const std::string& sku : skus) {
+            found += station.findStockIngredient(sku) != nullptr ? 1 : 0;
+        }
+    });
+    const int scans = 500;
+    int scanned = 0;
+    double scan_ms = timeMs([&] {
+        for (int i = 0; i < scans; i++) {
+            for (const Ingredient& ingredient : station.getIngredientsStock()) {
+                if (ingredient.name == skus[i * (SKUS / scans)]) {
+                    scanned++;
+                    break;
+                }
+            }
+        }
+    });
+
+    std::vector<int> orders, used(SKUS, 0);
+    for (int i = 0; i < SKU_ORDERS; i++) {
+        int d = static_cast<int>(rng() % SKU_DISHES);
+        orders.push_back(d);
+        for (int sku : recipes[d]) {
+            used[sku]++;
+        }
+    }
+    int completable = 0, prepared = 0;
+    double check_ms = timeMs([&] {
+        for (int d : orders) {
+            completable += station.canCompleteOrder(dish_ids[d]) ? 1 : 0;
+        }
+    });
+    double prepare_ms = timeMs([&] {
+        for (int d : orders) {
+            prepared += station.prepareDish(dish_ids[d]) ? 1 : 0;
+        }
+    });
+    std::cout << SKUS << " ingredients at one station: stock " << stock_ms << " ms, restock " << restock_ms
+              << " ms, findStockIngredient " << find_ms * 1000 / SKUS << " us, scan of getIngredientsStock "
+              << scan_ms * 1000 / scans << " us; " << SKU_ORDERS << " orders: canCompleteOrder " << check_ms
+              << " ms, prepareDish " << prepare_ms << " ms" << std::endl;
+
+    bool ok = found == SKUS && scanned == scans && completable == SKU_ORDERS && prepared == SKU_ORDERS;
+    for (int i = 0; i < SKUS; i++) {
+        const Ingredient* stock = station.findStockIngredient(skus[i]);
+        ok = ok && stock != nullptr && stock->quantity == 2 * SKU_ORDERS - used[i];
+    }
+    return ok;
+}
+
+const int ORDER_DISHES = 100;
+const int ORDER_DISH_INGREDIENTS = 10;
+const int ORDERS = 200000;
+
+// Prepares the same 200k orders at three identically stocked stations: checking with canCompleteOrder before
+// prepareDish, as prepareDishAtStation used to, with tryPrepareDish alone, and through prepareDishAtStation;
+// true if all three prepare the same orders and end with the same stock
+bool benchmarkOrderCost() {
+    std::mt19937 rng(235);
+    std::vector<std::vector<Ingredient>> recipes(ORDER_DISHES);
+    for (std::vector<Ingredient>& recipe : recipes) {
+        for (int i = 0; i < ORDER_DISH_INGREDIENTS; i++) {
+            int ingredient = static_cast<int>(rng() % INGREDIENTS);
+            recipe.push_back(Ingredient("Ingredient " + std::to_string(ingredient), 0, 1 + static_cast<int>(rng() % 3), 1.0));
+        }
+    }
+    StationManager manager;
+    std::vector<KitchenStation*> stations;
+    for (const char* name : {"Checked", "Try", "Managed"}) {
+        KitchenStation* station = new KitchenStation(name);
+        for (int d = 0; d < ORDER_DISHES; d++) {
+            Dish* dish = new Dessert();
+            dish->setName(dishName(d));
+            dish->setIngredients(recipes[d]);
+            station->assignDishToStation(dish);
+        }
+        // scarce enough that the last orders start to fail
+        for (int i = 0; i < INGREDIENTS; i++) {
+            station->replenishStationIngredients(Ingredient("Ingredient " + std::to_string(i), ORDERS / 2, 0, 1.0));
+        }
+        manager.addStation(station);
+        stations.push_back(station);
+    }
+    std::vector<int> orders;
+    std::vector<std::string> order_names;
+    for (int i = 0; i < ORDERS; i++) {
+        orders.push_back(static_cast<int>(rng() % ORDER_DISHES));
+        order_names.push_back(dishName(orders.back()));
+    }
+    std::vector<int> dish_ids;
+    for (int d = 0; d < ORDER_DISHES; d++) {
+        dish_ids.push_back(NameTable::find(dishName(d)));
+    }
+
+    int checked = 0, tried = 0, managed = 0;
+    double checked_ms = timeMs([&] {
+        for (int d : orders) {
+            if (stations[0]->canCompleteOrder(dish_ids[d]) && stations[0]->prepareDish(dish_ids[d])) {
+                checked++;
+            }
+        }
+    });
+    double tried_ms = timeMs([&] {
+        for (int d : orders) {
+            tried += stations[1]->tryPrepareDish(dish_ids[d]).ok() ? 1 : 0;
+        }
+    });
+    double managed_ms = timeMs([&] {
+        for (const std::string& name : order_names) {
+            managed += manager.prepareDishAtStation("Managed", name) ? 1 : 0;
+        }
+    });
+    std::cout << ORDERS << " orders of " << ORDER_DISH_INGREDIENTS << " ingredients: canCompleteOrder then prepareDish "
+              << checked_ms * 1000000 / ORDERS << " ns/order, tryPrepareDish " << tried_ms * 1000000 / ORDERS
+              << " ns/order, prepareDishAtStation " << managed_ms * 1000000 / ORDERS << " ns/order (" << tried
+              << " prepared)" << std::endl;
+
+    bool ok = checked == tried && tried == managed && tried > 0 && tried < ORDERS;
+    for (int i = 0; i < INGREDIENTS; i++) {
+        std::string ingredient = "Ingredient " + std::to_string(i);
+        const Ingredient* checked_stock = stations[0]->findStockIngredient(ingredient);
+        int quantity = checked_stock ? checked_stock->quantity : 0;
+        for (KitchenStation* station : {stations[1], stations[2]}) {
+            const Ingredient* stock = station->findStockIngredient(ingredient);
+            ok = ok && (stock ? stock->quantity : 0) == quantity;
+        }
+    }
+    manager.clear();
+    for (KitchenStation* station : stations) {
+        delete station;
+    }
+    return ok;
+}
+
+// Processes the same queue one dish at a time and batched; true if batched leaves no more dishes unprepared
+bool benchmarkProcessing(const char* label, int backup_per_ingredient) {
+    Kitchen one_by_one(backup_per_ingredient), batched(backup_per_ingredient);
+    NullBuffer discarded;
+    std::streambuf* console = std::cout.rdbuf(&discarded);
+    double one_by_one_ms = timeMs([&] { one_by_one.manager.processAllDishes(); });
+    double batched_ms = timeMs([&] { batched.manager.processAllDishesBatched(); });
+    std::cout.rdbuf(console);
+
+    size_t one_by_one_left = one_by_one.manager.getDishQueue().size();
+    size_t batched_left = batched.manager.getDishQueue().size();
+    std::cout << label << " backup, " << QUEUED << " dishes: processAllDishes " << one_by_one_ms << " ms, "
+              << one_by_one_left << " unprepared; processAllDishesBatched " << batched_ms << " ms, "
+              << batched_left << " unprepared" << std::endl;
+    return batched_left <= one_by_one_left;
+}
+
+int main() {
+    bool ok = true;
+    if (!benchmarkStationChurn()) {
+        std::cout << "FAILURE: the station list lost track of its stations" << std::endl;
+        ok = false;
+    }
+    if (!benchmarkDispatch()) {
+        std::cout << "FAILURE: dispatch left dishes unprepared or at the wrong station" << std::endl;
+        ok = false;
+    }
+    if (!benchmarkLargeStock()) {
+        std::cout << "FAILURE: the 5k-ingredient station ended with the wrong stock" << std::endl;
+        ok = false;
+    }
+    if (!benchmarkOrderCost()) {
+        std::cout << "FAILURE: preparing orders a different way prepared different orders" << std::endl;
+        ok = false;
+    }
+    bool processed = benchmarkProcessing("ample", 1000000);
+    processed = benchmarkProcessing("scarce", 10000) && processed;
+    if (!processed) {
+        std::cout << "FAILURE: processAllDishesBatched left more dishes unprepared" << std::endl;
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
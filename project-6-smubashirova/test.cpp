@@ -0,0 +1,417 @@
+//  Assignment: Project 6
+//  Description: This program tests that StationManager finds stations by
+//  name however they are renamed, that LinkedList's NodePool reuses freed
+//  node slots and gives every node back, that StationManager dispatches
+//  to dishes however they were assigned, that its backup stock and
+//  batched processing only move stock for dishes that get prepared, and
+//  that tryPrepareDish reports each status and the missing ingredients.
+
+#include "StationManager.hpp"
+#include "KitchenStation.hpp"
+#include "LinkedList.hpp"
+#include "Dessert.hpp"
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+// Whether the LinkedList mutators that would go around StationManager's indexes can be called on a T
+template <class T, class = void> struct CanInsert : std::false_type {};
+template <class T> struct CanInsert<T, decltype(void(std::declval<T&>().insert(0, nullptr)))> : std::true_type {};
+template <class T, class = void> struct CanRemoveAt : std::false_type {};
+template <class T> struct CanRemoveAt<T, decltype(void(std::declval<T&>().remove(0)))> : std::true_type {};
+template <class T, class = void> struct CanUnlink : std::false_type {};
+template <class T> struct CanUnlink<T, decltype(void(std::declval<T&>().unlink(nullptr)))> : std::true_type {};
+template <class T, class = void> struct CanWriteThroughIterator : std::false_type {};
+template <class T> struct CanWriteThroughIterator<T, decltype(void(*std::declval<T&>().begin() = nullptr))> : std::true_type {};
+
+static_assert(CanInsert<LinkedList<KitchenStation*>>::value && CanWriteThroughIterator<LinkedList<KitchenStation*>>::value,
+              "the checks below must be able to see the LinkedList mutators");
+static_assert(!CanInsert<StationManager>::value && !CanRemoveAt<StationManager>::value && !CanUnlink<StationManager>::value,
+              "StationManager must not expose LinkedList mutators that skip its indexes");
+static_assert(!CanWriteThroughIterator<StationManager>::value, "StationManager iterators must be read-only");
+static_assert(!std::is_convertible<StationManager*, LinkedList<KitchenStation*>*>::value,
+              "StationManager must not be usable as a plain LinkedList");
+
+// A dish that needs one unit of ingredient, or nothing if ingredient is empty
+Dish* makeDish(const std::string& name, const std::string& ingredient = "") {
+    Dish* dish = new Dessert();
+    dish->setName(name);
+    if (!ingredient.empty()) {
+        dish->setIngredients({Ingredient(ingredient, 0, 1, 1.0)});
+    }
+    return dish;
+}
+
+// The quantity of ingredient in stock at station, 0 if none
+int stockOf(const KitchenStation* station, const std::string& ingredient) {
+    const Ingredient* stocked = station->findStockIngredient(ingredient);
+    return stocked ? stocked->quantity : 0;
+}
+
+// A dish that needs the given ingredients, each with quantity 0 as a recipe lists it
+Dish* makeRecipe(const std::string& name, const std::vector<Ingredient>& ingredients) {
+    Dish* dish = new Dessert();
+    dish->setName(name);
+    dish->setIngredients(ingredients);
+    return dish;
+}
+
+// The backup stock as "name:quantity" entries in order, e.g. "Flour:5 Salt:1"
+std::string backupOf(const StationManager& manager) {
+    std::string backup;
+    for (const Ingredient& ingredient : manager.getBackupIngredients()) {
+        backup += (backup.empty() ? "" : " ") + ingredient.name + ":" + std::to_string(ingredient.quantity);
+    }
+    return backup;
+}
+
+// A kitchen to process a queue in, owning its stations and queued orders
+struct TestKitchen {
+    StationManager manager;
+    std::vector<KitchenStation*> stations;
+    std::vector<Dish*> orders;
+
+    KitchenStation* addStation(const std::string& name, Dish* dish) {
+        KitchenStation* station = new KitchenStation(name);
+        station->assignDishToStation(dish);
+        manager.addStation(station);
+        stations.push_back(station);
+        return station;
+    }
+    // Queues count orders for the dish, listing the ingredients the first station serving it lists
+    void order(const std::string& name, int count) {
+        std::vector<Ingredient> ingredients;
+        for (KitchenStation* station : stations) {
+            for (Dish* dish : station->getDishes()) {
+                if (dish->getName() == name && ingredients.empty()) {
+                    ingredients = dish->getIngredients();
+                }
+            }
+        }
+        for (int i = 0; i < count; i++) {
+            orders.push_back(makeRecipe(name, ingredients));
+            manager.addDishToQueue(orders.back());
+        }
+    }
+    // Processes the queue, one dish at a time or batched, with the report discarded; returns how many dishes are left
+    size_t process(bool batched) {
+        std::ostringstream report;
+        std::streambuf* console = std::cout.rdbuf(report.rdbuf());
+        if (batched) {
+            manager.processAllDishesBatched();
+        } else {
+            manager.processAllDishes();
+        }
+        std::cout.rdbuf(console);
+        return manager.getDishQueue().size();
+    }
+    ~TestKitchen() {
+        for (KitchenStation* station : stations) {
+            delete station;
+        }
+        for (Dish* order : orders) {
+            delete order;
+        }
+    }
+};
+
+int main() {
+    // Test findStation: a station renamed straight through KitchenStation::setName
+    StationManager manager;
+    KitchenStation* grill = new KitchenStation("Grill");
+    KitchenStation* oven = new KitchenStation("Oven");
+    manager.addStation(grill);
+    manager.addStation(oven);
+    grill->setName("Fryer");
+    assert(manager.findStation("Fryer") == grill);
+    assert(manager.findStation("Grill") == nullptr);
+    assert(manager.moveStationToFront("Fryer") && !manager.moveStationToFront("Grill"));
+
+    // Test renameStation: renaming through the manager still works
+    assert(manager.renameStation("Fryer", "Grill") && manager.findStation("Grill") == grill);
+    assert(!manager.renameStation("Fryer", "Wok") && manager.findStation("Fryer") == nullptr);
+
+    // Test findStation: stations sharing a name, renamed one at a time
+    KitchenStation* prep1 = new KitchenStation("Prep");
+    KitchenStation* prep2 = new KitchenStation("Prep");
+    manager.addStation(prep1);
+    manager.addStation(prep2);
+    assert(manager.findStation("Prep") == prep1);
+    prep1->setName("Pastry");
+    assert(manager.findStation("Prep") == prep2 && manager.findStation("Pastry") == prep1);
+    prep2->setName("Pastry");
+    assert(manager.findStation("Prep") == nullptr && manager.findStation("Pastry") == prep1);
+    std::vector<KitchenStation*> listed(manager.begin(), manager.end());
+    assert((listed == std::vector<KitchenStation*>{grill, oven, prep1, prep2}) && manager.getEntry(2) == prep1);
+    std::cout << "findStation: SUCCESS after direct renames" << std::endl;
+
+    // Test copies: every manager holding a station sees it renamed
+    StationManager copy(manager);
+    StationManager assigned;
+    assigned = manager;
+    oven->setName("Stove");
+    assert(manager.findStation("Stove") == oven && copy.findStation("Stove") == oven && assigned.findStation("Stove") == oven);
+    assert(copy.findStation("Oven") == nullptr && assigned.findStation("Oven") == nullptr);
+
+    // Test removeStation: a removed station renamed later stays out of the manager
+    assert(copy.removeStation("Stove"));
+    oven->setName("Oven");
+    assert(copy.findStation("Oven") == nullptr && manager.findStation("Oven") == oven);
+    std::cout << "findStation: SUCCESS for copied managers" << std::endl;
+
+    // Test lifetimes: renaming after a manager is cleared or destroyed, and deleting a station still in a manager
+    {
+        StationManager scoped(manager);
+        scoped.clear();
+        assert(scoped.isEmpty() && scoped.findStation("Oven") == nullptr);
+        grill->setName("Smoker");
+        assert(scoped.findStation("Smoker") == nullptr && manager.findStation("Smoker") == grill);
+        StationManager temporary(manager);
+    }
+    grill->setName("Grill");
+    assert(manager.findStation("Grill") == grill);
+    delete oven;
+    assert(manager.findStation("Oven") == nullptr && assigned.findStation("Oven") == nullptr);
+    assert(manager.getLength() == 3);
+    std::cout << "findStation: SUCCESS across manager and station lifetimes" << std::endl;
+
+    delete grill;
+    delete prep1;
+    delete prep2;
+    assert(manager.isEmpty() && copy.isEmpty() && assigned.isEmpty());
+    assert(manager.getNodeAllocator().getNodesInUse() == 0 && copy.getNodeAllocator().getNodesInUse() == 0);
+
+    // Test NodePool: the first 16 nodes come from a single slab
+    LinkedList<int> list;
+    for (int i = 0; i < 16; i++) {
+        list.insert(i, i);
+    }
+    const NodePool<int>& pool = list.getNodeAllocator();
+    assert(pool.getHeapAllocations() == 1 && pool.getNodesCreated() == 16);
+    assert(pool.getNodesReused() == 0 && pool.getNodesInUse() == 16);
+
+    // Test NodePool: a removed node's slot is handed to the next insert
+    Node<int>* freed = list.getPointerTo(5);
+    assert(list.remove(5) && pool.getNodesInUse() == 15);
+    assert(list.insert(0, 100) && list.getHeadNode() == freed && list.getEntry(0) == 100);
+    assert(pool.getNodesReused() == 1 && pool.getNodesCreated() == 17 && pool.getHeapAllocations() == 1);
+
+    // Test NodePool: once the slab is full a second (larger) slab is allocated
+    list.insert(16, 16);
+    assert(pool.getHeapAllocations() == 2 && pool.getNodesInUse() == 17);
+
+    // Test NodePool: clear gives every node back, and the next inserts reuse them without new slabs
+    list.clear();
+    assert(list.isEmpty() && pool.getNodesInUse() == 0);
+    for (int i = 0; i < 17; i++) {
+        list.insert(0, i);
+    }
+    assert(pool.getNodesReused() == 18 && pool.getHeapAllocations() == 2 && pool.getNodesInUse() == 17);
+
+    // Test NodePool: unlink and a copied list's own pool
+    LinkedList<int> list_copy(list);
+    assert(list_copy.getNodeAllocator().getNodesInUse() == 17 && list_copy.getNodeAllocator().getNodesReused() == 0);
+    assert(list.unlink(list.getTailNode()) && pool.getNodesInUse() == 16);
+    list_copy.clear();
+    assert(list_copy.getNodeAllocator().getNodesInUse() == 0 && pool.getNodesInUse() == 16);
+
+    // Test HeapNodeAllocator: every node is its own heap allocation and nothing is reused
+    LinkedList<int, HeapNodeAllocator<int>> heap_list;
+    for (int i = 0; i < 10; i++) {
+        heap_list.insert(0, i);
+    }
+    heap_list.remove(0);
+    heap_list.insert(0, 10);
+    const HeapNodeAllocator<int>& heap = heap_list.getNodeAllocator();
+    assert(heap.getHeapAllocations() == 11 && heap.getNodesReused() == 0 && heap.getNodesInUse() == 10);
+    heap_list.clear();
+    assert(heap.getNodesInUse() == 0);
+    std::cout << "NodePool: SUCCESS for slot reuse and clear" << std::endl;
+
+    // Test canCompleteOrder: dishes assigned straight to a station, before and after it is added
+    StationManager kitchen;
+    KitchenStation* soup = new KitchenStation("Soup");
+    KitchenStation* salad = new KitchenStation("Salad");
+    soup->assignDishToStation(makeDish("Broth"));
+    kitchen.addStation(soup);
+    kitchen.addStation(salad);
+    assert(kitchen.canCompleteOrder("Broth") && !kitchen.canCompleteOrder("Caesar"));
+    kitchen.findStation("Salad")->assignDishToStation(makeDish("Caesar", "Lettuce"));
+    assert(!kitchen.canCompleteOrder("Caesar"));  // Served, but no lettuce in stock
+    salad->replenishStationIngredients(Ingredient("Lettuce", 1, 0, 1.0));
+    assert(kitchen.canCompleteOrder("Caesar"));
+
+    // Test prepareNextDish: dispatch reaches directly assigned stations, in list order
+    StationManager kitchen_copy(kitchen);
+    KitchenStation* backup_salad = new KitchenStation("Backup Salad");
+    kitchen.addStation(backup_salad);
+    backup_salad->assignDishToStation(makeDish("Caesar", "Lettuce"));
+    backup_salad->replenishStationIngredients(Ingredient("Lettuce", 5, 0, 1.0));
+    Dish* orders[3] = {makeDish("Caesar", "Lettuce"), makeDish("Caesar", "Lettuce"), makeDish("Caesar", "Lettuce")};
+    for (Dish* order : orders) {
+        kitchen.addDishToQueue(order);
+    }
+    assert(kitchen.prepareNextDish() && stockOf(salad, "Lettuce") == 0 && stockOf(backup_salad, "Lettuce") == 5);
+    assert(kitchen.prepareNextDish() && stockOf(backup_salad, "Lettuce") == 4);
+    assert(kitchen.moveStationToFront("Backup Salad"));
+    salad->replenishStationIngredients(Ingredient("Lettuce", 1, 0, 1.0));
+    assert(kitchen.prepareNextDish() && stockOf(backup_salad, "Lettuce") == 3 && stockOf(salad, "Lettuce") == 1);
+    for (Dish* order : orders) {
+        delete order;
+    }
+
+    // Test the dish index: only managers holding a station see dishes assigned to it
+    StationManager unrelated;
+    KitchenStation* grill_station = new KitchenStation("Grill");
+    unrelated.addStation(grill_station);
+    salad->assignDishToStation(makeDish("Cobb"));
+    assert(kitchen.canCompleteOrder("Cobb") && kitchen_copy.canCompleteOrder("Cobb") && !unrelated.canCompleteOrder("Cobb"));
+    Dish* steak = makeDish("Steak");
+    assert(!kitchen.assignDishToStation("Grill", steak));  // Not in this manager
+    delete steak;
+    assert(unrelated.assignDishToStation("Grill", makeDish("Steak")) && unrelated.canCompleteOrder("Steak"));
+    assert(!kitchen.canCompleteOrder("Steak"));
+
+    // Test the dish index: a removed station's new dishes stay out of the manager that removed it
+    assert(kitchen.removeStation("Soup"));
+    soup->assignDishToStation(makeDish("Stew"));
+    assert(!kitchen.canCompleteOrder("Stew") && !kitchen.canCompleteOrder("Broth"));
+    assert(kitchen_copy.canCompleteOrder("Stew") && kitchen_copy.canCompleteOrder("Broth"));
+
+    // Test mergeStations: merged dishes are served by the remaining station
+    KitchenStation* dessert = new KitchenStation("Dessert");
+    dessert->assignDishToStation(makeDish("Pie"));
+    dessert->assignDishToStation(makeDish("Cobb"));  // Salad already serves its own Cobb
+    kitchen.addStation(dessert);
+    StationManager dessert_menu;
+    dessert_menu.addStation(dessert);
+    assert(kitchen.mergeStations("Salad", "Dessert") && kitchen.findStation("Dessert") == nullptr);
+    assert(kitchen.canCompleteOrder("Pie") && salad->hasDish(NameTable::find("Pie")));
+
+    // Test mergeStations: the merged-away station hands over its dishes, so only one station deletes each
+    assert(!dessert->hasDish(NameTable::find("Pie")) && dessert->hasDish(NameTable::find("Cobb")));
+    assert(dessert->getDishes().size() == 1 && salad->getDishes().size() == 3);
+    assert(!dessert_menu.canCompleteOrder("Pie") && dessert_menu.canCompleteOrder("Cobb"));
+    std::cout << "canCompleteOrder and prepareNextDish: SUCCESS for directly assigned dishes" << std::endl;
+
+    delete soup;
+    delete salad;  // Also frees Pie, which the dessert station handed over
+    delete dessert;
+    delete backup_salad;
+    delete grill_station;
+    assert(kitchen.isEmpty() && kitchen_copy.isEmpty() && unrelated.isEmpty() && dessert_menu.isEmpty());
+
+    // Test the backup stock: used-up ingredients drop out in place, and a repeated name takes over in order
+    StationManager pantry;
+    KitchenStation* line = new KitchenStation("Line");
+    pantry.addStation(line);
+    pantry.addBackupIngredients({Ingredient("Flour", 5, 0, 1.0), Ingredient("Sugar", 3, 0, 1.0),
+                                 Ingredient("Flour", 2, 0, 1.0), Ingredient("Salt", 1, 0, 1.0)});
+    assert(pantry.replenishStationIngredientFromBackup("Line", "Sugar", 3) && stockOf(line, "Sugar") == 3);
+    assert(backupOf(pantry) == "Flour:5 Flour:2 Salt:1");
+    assert(!pantry.replenishStationIngredientFromBackup("Line", "Flour", 6));  // Only the first Flour is drawn from
+    assert(pantry.replenishStationIngredientFromBackup("Line", "Flour", 5) && backupOf(pantry) == "Flour:2 Salt:1");
+    assert(pantry.replenishStationIngredientFromBackup("Line", "Flour", 2) && stockOf(line, "Flour") == 7);
+    assert(!pantry.replenishStationIngredientFromBackup("Line", "Flour", 1) && backupOf(pantry) == "Salt:1");
+    pantry.addBackupIngredient(Ingredient("Sugar", 4, 0, 1.0));
+    assert(backupOf(pantry) == "Salt:1 Sugar:4");
+
+    // Test the backup stock: copies keep their own stock, and compaction keeps the order
+    StationManager pantry_copy(pantry);
+    assert(pantry_copy.replenishStationIngredientFromBackup("Line", "Salt", 1) && backupOf(pantry_copy) == "Sugar:4");
+    assert(backupOf(pantry) == "Salt:1 Sugar:4");
+    for (int i = 0; i < 10; i++) {
+        pantry.addBackupIngredient(Ingredient("Spice" + std::to_string(i), 1, 0, 1.0));
+    }
+    for (int i = 0; i < 10; i += 2) {
+        assert(pantry.replenishStationIngredientFromBackup("Line", "Spice" + std::to_string(i), 1));
+    }
+    assert(pantry.replenishStationIngredientFromBackup("Line", "Sugar", 4));
+    assert(backupOf(pantry) == "Salt:1 Spice1:1 Spice3:1 Spice5:1 Spice7:1 Spice9:1");
+    assert(pantry.replenishStationIngredientFromBackup("Line", "Spice5", 1) && !pantry.replenishStationIngredientFromBackup("Line", "Spice5", 1));
+    assert(pantry.replenishStationIngredientFromBackup("Line", "Spice9", 1) && backupOf(pantry) == "Salt:1 Spice1:1 Spice3:1 Spice7:1");
+    delete line;
+    std::cout << "getBackupIngredients: SUCCESS for used-up and repeated ingredients" << std::endl;
+
+    // Test processAllDishesBatched: with ample backup it prepares what processAllDishes does, leaving the same stock
+    TestKitchen one_by_one, batched;
+    for (TestKitchen* test_kitchen : {&one_by_one, &batched}) {
+        test_kitchen->addStation("Grill", makeRecipe("Steak", {Ingredient("Beef", 0, 2, 1.0), Ingredient("Salt", 0, 1, 1.0)}));
+        test_kitchen->addStation("Oven", makeRecipe("Roast", {Ingredient("Beef", 0, 3, 1.0)}));
+        test_kitchen->stations[1]->replenishStationIngredients(Ingredient("Beef", 4, 0, 1.0));
+        test_kitchen->manager.addBackupIngredients({Ingredient("Beef", 100, 0, 1.0), Ingredient("Salt", 100, 0, 1.0)});
+        test_kitchen->order("Steak", 2);
+        test_kitchen->order("Roast", 3);
+        test_kitchen->order("Pie", 1);
+    }
+    assert(one_by_one.process(false) == 1 && batched.process(true) == 1);
+    assert(batched.manager.getDishQueue().front()->getName() == "Pie");
+    assert(backupOf(batched.manager) == backupOf(one_by_one.manager) && backupOf(batched.manager) == "Beef:91 Salt:98");
+    for (size_t i = 0; i < batched.stations.size(); i++) {
+        assert(stockOf(batched.stations[i], "Beef") == stockOf(one_by_one.stations[i], "Beef"));
+    }
+
+    // Test processAllDishesBatched: no stock is moved for a dish the backup cannot cover in full
+    TestKitchen partial, whole;
+    for (TestKitchen* test_kitchen : {&partial, &whole}) {
+        test_kitchen->addStation("Bakery", makeRecipe("Tart", {Ingredient("Flour", 0, 1, 1.0), Ingredient("Butter", 0, 1, 1.0)}));
+        test_kitchen->manager.addBackupIngredients({Ingredient("Flour", 5, 0, 1.0)});
+        test_kitchen->order("Tart", 2);
+    }
+    assert(partial.process(false) == 2 && stockOf(partial.stations[0], "Flour") == 1 && backupOf(partial.manager) == "Flour:4");
+    assert(whole.process(true) == 2 && stockOf(whole.stations[0], "Flour") == 0 && backupOf(whole.manager) == "Flour:5");
+    whole.manager.addBackupIngredient(Ingredient("Butter", 1, 0, 1.0));
+    assert(whole.process(true) == 1 && backupOf(whole.manager) == "Flour:4");
+    assert(stockOf(whole.stations[0], "Flour") == 0 && stockOf(whole.stations[0], "Butter") == 0);
+
+    // Test processAllDishesBatched: a station further down the list is planned, and stocked, when the first cannot be
+    TestKitchen first_only, fallback;
+    for (TestKitchen* test_kitchen : {&first_only, &fallback}) {
+        test_kitchen->addStation("Salad", makeRecipe("Caesar", {Ingredient("Lettuce", 0, 1, 1.0), Ingredient("Croutons", 0, 1, 1.0)}));
+        test_kitchen->addStation("Wrap", makeRecipe("Caesar", {Ingredient("Lettuce", 0, 1, 1.0)}));
+        test_kitchen->manager.addBackupIngredients({Ingredient("Lettuce", 3, 0, 1.0)});
+        test_kitchen->order("Caesar", 3);
+    }
+    assert(first_only.process(false) == 2 && stockOf(first_only.stations[0], "Lettuce") == 1);
+    assert(fallback.process(true) == 0 && backupOf(fallback.manager) == "");
+    assert(stockOf(fallback.stations[0], "Lettuce") == 0 && stockOf(fallback.stations[1], "Lettuce") == 0);
+    std::cout << "processAllDishesBatched: SUCCESS for whole-dish top-ups and fallback stations" << std::endl;
+
+    // Test tryPrepareDish: a dish the station does not serve, and one it is short of, leave the stock untouched
+    KitchenStation bakery("Bakery");
+    bakery.assignDishToStation(makeRecipe("Bread", {Ingredient("Flour", 0, 3, 1.0), Ingredient("Yeast", 0, 1, 1.0),
+                                                    Ingredient("Salt", 0, 1, 1.0)}));
+    bakery.replenishStationIngredients(Ingredient("Flour", 2, 0, 1.0));
+    bakery.replenishStationIngredients(Ingredient("Salt", 4, 0, 1.0));
+    assert(bakery.findDish(NameTable::find("Bread"))->getName() == "Bread" && bakery.findDish(NameTable::find("Cake")) == nullptr);
+    KitchenStation::PrepareResult not_served = bakery.tryPrepareDish("Cake");
+    assert(not_served.status == KitchenStation::PrepareResult::DISH_NOT_AVAILABLE && !not_served.ok() && not_served.missing.empty());
+    KitchenStation::PrepareResult short_of = bakery.tryPrepareDish("Bread");
+    assert(short_of.status == KitchenStation::PrepareResult::INSUFFICIENT_INGREDIENTS && !short_of.ok());
+    assert(short_of.missing.size() == 2);
+    assert(short_of.missing[0].name == "Flour" && short_of.missing[0].quantity == 2 && short_of.missing[0].required_quantity == 3);
+    assert(short_of.missing[1].name == "Yeast" && short_of.missing[1].quantity == 0 && short_of.missing[1].required_quantity == 1);
+    assert(stockOf(&bakery, "Flour") == 2 && stockOf(&bakery, "Salt") == 4);
+
+    // Test tryPrepareDish: once stocked, the dish is prepared in one pass and used-up ingredients leave the stock
+    bakery.replenishStationIngredients(Ingredient("Flour", 1, 0, 1.0));
+    bakery.replenishStationIngredients(Ingredient("Yeast", 1, 0, 1.0));
+    KitchenStation::PrepareResult baked = bakery.tryPrepareDish(NameTable::find("Bread"));
+    assert(baked.status == KitchenStation::PrepareResult::PREPARED && baked.ok() && baked.missing.empty());
+    assert(bakery.findStockIngredient("Flour") == nullptr && bakery.findStockIngredient("Yeast") == nullptr);
+    assert(stockOf(&bakery, "Salt") == 3);
+    assert(bakery.tryPrepareDish("Bread").missing.size() == 2);
+
+    // Test prepareDishAtStation: it reports the same outcome through the manager
+    StationManager bakery_manager;
+    bakery_manager.addStation(&bakery);
+    assert(!bakery_manager.prepareDishAtStation("Bakery", "Bread") && !bakery_manager.prepareDishAtStation("Bakery", "Cake"));
+    bakery.replenishStationIngredients(Ingredient("Flour", 3, 0, 1.0));
+    bakery.replenishStationIngredients(Ingredient("Yeast", 1, 0, 1.0));
+    assert(!bakery_manager.prepareDishAtStation("Oven", "Bread") && bakery_manager.prepareDishAtStation("Bakery", "Bread"));
+    assert(stockOf(&bakery, "Flour") == 0 && stockOf(&bakery, "Salt") == 2);
+    std::cout << "tryPrepareDish: SUCCESS for each status and the missing ingredients" << std::endl;
+    return 0;
+}
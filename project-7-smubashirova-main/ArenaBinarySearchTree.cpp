@@ -0,0 +1,315 @@
+#include "ArenaBinarySearchTree.hpp"
+
+
+/*CONSTRUCTRS*/
+
+template <class T, class BalancePolicy>
+ArenaBinarySearchTree<T, BalancePolicy>::ArenaBinarySearchTree()
+    : root_(NIL), free_list_(NIL), node_count_(0)
+{
+} // end default constructor
+
+template <class T, class BalancePolicy>
+ArenaBinarySearchTree<T, BalancePolicy>::ArenaBinarySearchTree(const T &root_item)
+    : root_(NIL), free_list_(NIL), node_count_(0)
+{
+  add(root_item);
+} // end constructor
+
+
+
+/*PUBLIC METHODS*/
+
+/** @return true if the tree is emtpy, false otherwise **/
+template <class T, class BalancePolicy>
+bool ArenaBinarySearchTree<T, BalancePolicy>::isEmpty() const
+{
+  return root_ == NIL;
+} // end isEmpty
+
+/** @return the height of the tree as the number of nodes on the longest path from root to leaf**/
+template <class T, class BalancePolicy>
+int ArenaBinarySearchTree<T, BalancePolicy>::getHeight() const
+{
+  return heightOf(root_);
+} // end getHeight
+
+/** @return the number of items in the tree**/
+template <class T, class BalancePolicy>
+int ArenaBinarySearchTree<T, BalancePolicy>::getNumberOfNodes() const
+{
+  return node_count_;
+} // end getNumberOfNodes
+
+/** @param a new entry to be added to the tree
+    @post new entry is added to the tree retaining the BST property **/
+template <class T, class BalancePolicy>
+void ArenaBinarySearchTree<T, BalancePolicy>::add(const T &new_entry)
+{
+  // Allocate first so the arena does not grow while placeNode holds indices into it
+  std::uint32_t new_node = allocateNode(new_entry);
+  root_ = placeNode(new_node);
+} // end add
+
+/** @param entry to be removed from the tree
+    @post entry is removed from the tree retaining the BST property; its slot is put on the free list
+    @return true if the entry was found and removed, false otherwise **/
+template <class T, class BalancePolicy>
+bool ArenaBinarySearchTree<T, BalancePolicy>::remove(const T &entry)
+{
+  bool is_successful = false;
+  root_ = removeValue(entry, is_successful);
+  return is_successful;
+} // end remove
+
+/** @param entry to be found in the tree
+    @return true if entry is found in the tree, false otherwise**/
+template <class T, class BalancePolicy>
+bool ArenaBinarySearchTree<T, BalancePolicy>::contains(const T &entry) const
+{
+  return find(entry) != nullptr;
+} // end contains
+
+/** @param entry to be found in the tree
+    @return a pointer to the stored item equal to entry, nullptr if not found **/
+template <class T, class BalancePolicy>
+const T *ArenaBinarySearchTree<T, BalancePolicy>::find(const T &entry) const
+{
+  std::uint32_t current = root_;
+  while (current != NIL)
+  {
+    const ArenaNode &node = nodes_[current];
+    if (node.item == entry)
+      return &node.item; // Found
+    current = (node.item > entry) ? node.left : node.right;
+  }
+  return nullptr; // Not found
+} // end find
+
+/** @param visit called as visit(item) on every item in sorted (inorder) order
+    @post the tree is unchanged; the walk uses an explicit stack of indices, so an unbalanced tree cannot overflow the call stack **/
+template <class T, class BalancePolicy>
+template <class Visit>
+void ArenaBinarySearchTree<T, BalancePolicy>::inorderTraverse(Visit visit) const
+{
+  std::vector<std::uint32_t> pending; // Nodes whose left subtree is being visited
+  std::uint32_t current = root_;
+  while (current != NIL || !pending.empty())
+  {
+    while (current != NIL)
+    {
+      pending.push_back(current);
+      current = nodes_[current].left;
+    }
+    current = pending.back();
+    pending.pop_back();
+    visit(nodes_[current].item);
+    current = nodes_[current].right;
+  }
+} // end inorderTraverse
+
+/** @post the tree is empty and the arena is released in one shot **/
+template <class T, class BalancePolicy>
+void ArenaBinarySearchTree<T, BalancePolicy>::clear()
+{
+  std::vector<ArenaNode>().swap(nodes_);
+  root_ = NIL;
+  free_list_ = NIL;
+  node_count_ = 0;
+} // end clear
+
+/** @param capacity the number of nodes to reserve room for **/
+template <class T, class BalancePolicy>
+void ArenaBinarySearchTree<T, BalancePolicy>::reserve(std::size_t capacity)
+{
+  nodes_.reserve(capacity);
+} // end reserve
+
+
+
+/*PRIVATE METHODS*/
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::allocateNode(const T &new_entry)
+{
+  std::uint32_t index;
+  if (free_list_ != NIL)
+  {
+    // Reuse a removed slot
+    index = free_list_;
+    free_list_ = nodes_[index].left;
+    nodes_[index].item = new_entry;
+  }
+  else
+  {
+    index = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.push_back(ArenaNode{new_entry, NIL, NIL, 1});
+  }
+  nodes_[index].left = NIL;
+  nodes_[index].right = NIL;
+  nodes_[index].height = 1;
+  node_count_++;
+  return index;
+} // end allocateNode
+
+template <class T, class BalancePolicy>
+void ArenaBinarySearchTree<T, BalancePolicy>::releaseNode(std::uint32_t index)
+{
+  // Drop whatever the item holds now rather than when the slot is reused
+  nodes_[index].item = T();
+  nodes_[index].left = free_list_;
+  nodes_[index].right = NIL;
+  free_list_ = index;
+  node_count_--;
+} // end releaseNode
+
+template <class T, class BalancePolicy>
+int ArenaBinarySearchTree<T, BalancePolicy>::heightOf(std::uint32_t index) const
+{
+  return (index == NIL) ? 0 : nodes_[index].height;
+} // end heightOf
+
+template <class T, class BalancePolicy>
+void ArenaBinarySearchTree<T, BalancePolicy>::updateHeight(std::uint32_t index)
+{
+  int left_height = heightOf(nodes_[index].left);
+  int right_height = heightOf(nodes_[index].right);
+  nodes_[index].height = 1 + ((left_height > right_height) ? left_height : right_height);
+} // end updateHeight
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::placeNode(std::uint32_t new_node)
+{
+  // Walk down with an explicit path instead of recursing, so a degenerate
+  // unbalanced tree cannot overflow the call stack
+  path_.clear();
+  std::uint32_t current = root_;
+  while (current != NIL)
+  {
+    bool go_left = nodes_[current].item > nodes_[new_node].item;
+    path_.push_back(PathStep{current, go_left});
+    current = go_left ? nodes_[current].left : nodes_[current].right;
+  }
+  return unwindPath(0, new_node);
+} // end placeNode
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::removeValue(const T &target, bool &success)
+{
+  path_.clear();
+  std::uint32_t current = root_;
+  while (current != NIL && !(nodes_[current].item == target))
+  {
+    bool go_left = nodes_[current].item > target;
+    path_.push_back(PathStep{current, go_left});
+    current = go_left ? nodes_[current].left : nodes_[current].right;
+  }
+  if (current == NIL)
+  {
+    // Not found - nothing was changed, so the path needs no unwinding
+    success = false;
+    return root_;
+  }
+  success = true;
+  return unwindPath(0, removeNode(current));
+} // end removeValue
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::unwindPath(std::size_t base, std::uint32_t child)
+{
+  while (path_.size() > base)
+  {
+    PathStep step = path_.back();
+    path_.pop_back();
+    if (step.went_left)
+      nodes_[step.index].left = child;
+    else
+      nodes_[step.index].right = child;
+    updateHeight(step.index);
+    child = rebalance(step.index);
+  }
+  return child;
+} // end unwindPath
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::removeNode(std::uint32_t index)
+{
+  std::uint32_t left = nodes_[index].left;
+  std::uint32_t right = nodes_[index].right;
+  releaseNode(index);
+
+  // Leaf or one child - parent adopts the (possibly empty) child
+  if (left == NIL)
+    return right;
+  if (right == NIL)
+    return left;
+
+  // Two children - relink the inorder successor node in place of the removed one
+  // instead of copying its item
+  std::uint32_t successor = NIL;
+  right = removeLeftmostNode(right, successor);
+  nodes_[successor].left = left;
+  nodes_[successor].right = right;
+  updateHeight(successor);
+  return rebalance(successor);
+} // end removeNode
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::removeLeftmostNode(std::uint32_t index, std::uint32_t &leftmost)
+{
+  // Stack the left spine on top of the path removeValue is holding, then unwind only our part
+  std::size_t base = path_.size();
+  while (nodes_[index].left != NIL)
+  {
+    path_.push_back(PathStep{index, true});
+    index = nodes_[index].left;
+  }
+  leftmost = index;
+  return unwindPath(base, nodes_[index].right);
+} // end removeLeftmostNode
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::rebalance(std::uint32_t subtree)
+{
+  if (!BalancePolicy::self_balancing)
+    return subtree;
+
+  int balance_factor = heightOf(nodes_[subtree].left) - heightOf(nodes_[subtree].right);
+  if (balance_factor > 1)
+  {
+    std::uint32_t left = nodes_[subtree].left;
+    if (heightOf(nodes_[left].left) < heightOf(nodes_[left].right))
+      nodes_[subtree].left = rotateLeft(left);
+    return rotateRight(subtree);
+  }
+  else if (balance_factor < -1)
+  {
+    std::uint32_t right = nodes_[subtree].right;
+    if (heightOf(nodes_[right].right) < heightOf(nodes_[right].left))
+      nodes_[subtree].right = rotateRight(right);
+    return rotateLeft(subtree);
+  }
+  return subtree;
+} // end rebalance
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::rotateRight(std::uint32_t subtree)
+{
+  std::uint32_t new_root = nodes_[subtree].left;
+  nodes_[subtree].left = nodes_[new_root].right;
+  nodes_[new_root].right = subtree;
+  updateHeight(subtree);
+  updateHeight(new_root);
+  return new_root;
+} // end rotateRight
+
+template <class T, class BalancePolicy>
+std::uint32_t ArenaBinarySearchTree<T, BalancePolicy>::rotateLeft(std::uint32_t subtree)
+{
+  std::uint32_t new_root = nodes_[subtree].right;
+  nodes_[subtree].right = nodes_[new_root].left;
+  nodes_[new_root].left = subtree;
+  updateHeight(subtree);
+  updateHeight(new_root);
+  return new_root;
+} // end rotateLeft
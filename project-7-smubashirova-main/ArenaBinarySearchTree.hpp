@@ -0,0 +1,129 @@
+#ifndef ARENA_BINARY_SEARCH_TREE_
+#define ARENA_BINARY_SEARCH_TREE_
+
+#include "BinarySearchTree.hpp" // for the NoBalancing / AVLBalancing policies
+#include <cstdint>
+#include <vector>
+
+/** A binary search tree with the same add/remove/contains interface as
+    BinarySearchTree, but whose nodes live in one contiguous arena owned by
+    the tree instead of individually allocated shared_ptr nodes.
+    Children are 32-bit indices into the arena, so walking an edge is a plain
+    array access with no reference counting. Removed slots are kept on a free
+    list and reused by later adds; clear() and destruction release the whole
+    arena in one shot. **/
+template <class T, class BalancePolicy = NoBalancing>
+class ArenaBinarySearchTree
+{
+public:
+  /*Constructors*/
+  ArenaBinarySearchTree();                   //default constructor
+  ArenaBinarySearchTree(const T &root_item); //parameterized constructor
+
+  /** @return true if the tree is emtpy, false otherwise **/
+  bool isEmpty() const;
+
+  /** @return the height of the tree as the number of nodes on the longest path from root to leaf**/
+  int getHeight() const;
+
+  /** @return the number of items in the tree**/
+  int getNumberOfNodes() const;
+
+  /** @param a new entry to be added to the tree
+      @post new entry is added to the tree retaining the BST property **/
+  void add(const T &new_entry);
+
+  /** @param entry to be removed from the tree
+      @post entry is removed from the tree retaining the BST property; its slot is put on the free list
+      @return true if the entry was found and removed, false otherwise **/
+  bool remove(const T &entry);
+
+  /** @param entry to be found in the tree
+      @return true if entry is found in the tree, false otherwise**/
+  bool contains(const T &entry) const;
+
+  /** @param entry to be found in the tree
+      @return a pointer to the stored item equal to entry, nullptr if not found.
+              The pointer is invalidated by the next add (the arena may grow) **/
+  const T *find(const T &entry) const;
+
+  /** @param visit called as visit(item) on every item in sorted (inorder) order
+      @post the tree is unchanged; the walk uses an explicit stack of indices, so an unbalanced tree cannot overflow the call stack **/
+  template <class Visit>
+  void inorderTraverse(Visit visit) const;
+
+  /** @post the tree is empty and the arena is released in one shot **/
+  void clear();
+
+  /** @param capacity the number of nodes to reserve room for
+      @post the arena can hold capacity nodes without reallocating **/
+  void reserve(std::size_t capacity);
+
+private:
+  static const std::uint32_t NIL = 0xFFFFFFFFu; // "null" child index
+
+  struct PathStep
+  {
+    std::uint32_t index; // A node on the path from the root
+    bool went_left;      // true if the path continues into its left child
+  };
+
+  struct ArenaNode
+  {
+    T item;
+    std::uint32_t left;  // Index of left child, NIL if none (next free slot while on the free list)
+    std::uint32_t right; // Index of right child, NIL if none
+    int height;          // Number of nodes on the longest path from this node to a leaf
+  };
+
+  std::vector<ArenaNode> nodes_; // The arena
+  std::uint32_t root_;           // Index of the root, NIL if empty
+  std::uint32_t free_list_;      // Head of the list of removed slots, NIL if none
+  int node_count_;               // Number of live nodes
+  std::vector<PathStep> path_;   // Scratch stack of the nodes visited on the way down, reused across calls
+
+  /** @return the index of a slot holding new_entry, taken from the free list if possible **/
+  std::uint32_t allocateNode(const T &new_entry);
+
+  /** @post the slot at index is reset to a default item and pushed onto the free list **/
+  void releaseNode(std::uint32_t index);
+
+  /** @return the cached height of the node at index, 0 for NIL **/
+  int heightOf(std::uint32_t index) const;
+
+  /** @post recomputes the height of the node at index from its children **/
+  void updateHeight(std::uint32_t index);
+
+  /** called by add(new_entry)
+      @return the index of the root of the tree after the new node was placed **/
+  std::uint32_t placeNode(std::uint32_t new_node);
+
+  /** called by remove
+      @return the index of the root of the tree after target was removed **/
+  std::uint32_t removeValue(const T &target, bool &success);
+
+  /** called by placeNode and the remove helpers on the way back up
+      @param base the path_ depth at which to stop
+      @param child the new root of the subtree below the deepest step
+      @post every step above base is popped, relinked to its new child, and rebalanced
+      @return the index of the root of the subtree at depth base **/
+  std::uint32_t unwindPath(std::size_t base, std::uint32_t child);
+
+  /** called by removeValue
+      @return the index of the root of the subtree after the node at index was removed **/
+  std::uint32_t removeNode(std::uint32_t index);
+
+  /** called by removeNode
+      @param index the root of the subtree whose leftmost node is unlinked
+      @param leftmost set to the index of the unlinked node
+      @return the index of the root of the subtree after the leftmost node was unlinked **/
+  std::uint32_t removeLeftmostNode(std::uint32_t index, std::uint32_t &leftmost);
+
+  /** called by unwindPath
+      @return the index of the root of the (possibly rotated) subtree **/
+  std::uint32_t rebalance(std::uint32_t subtree);
+  std::uint32_t rotateRight(std::uint32_t subtree);
+  std::uint32_t rotateLeft(std::uint32_t subtree);
+};
+#include "ArenaBinarySearchTree.cpp"
+#endif
@@ -6,23 +6,35 @@
 
 #include "BinaryNode.hpp"
 #include <cstddef>
+#include <utility>
 
 template<class T>
 BinaryNode<T>::BinaryNode()
-      : item(nullptr), leftChildPtr(nullptr), rightChildPtr(nullptr)
+      : item(nullptr), leftChildPtr(nullptr), rightChildPtr(nullptr), parentPtr(nullptr), height(1), size(1)
 { }  // end default constructor
 
 template<class T>
 BinaryNode<T>::BinaryNode(const T& anItem)
-      : item(anItem), leftChildPtr(nullptr), rightChildPtr(nullptr)
+      : item(anItem), leftChildPtr(nullptr), rightChildPtr(nullptr), parentPtr(nullptr), height(1), size(1)
+{ }  // end constructor
+
+template<class T>
+BinaryNode<T>::BinaryNode(T&& anItem)
+      : item(std::move(anItem)), leftChildPtr(nullptr), rightChildPtr(nullptr), parentPtr(nullptr), height(1), size(1)
 { }  // end constructor
 
 template<class T>
 BinaryNode<T>::BinaryNode(const T& anItem,
                                     std::shared_ptr<BinaryNode<T>> leftPtr,
                                     std::shared_ptr<BinaryNode<T>> rightPtr)
-      : item(anItem), leftChildPtr(leftPtr), rightChildPtr(rightPtr)
-{ }  // end constructor
+      : item(anItem), leftChildPtr(leftPtr), rightChildPtr(rightPtr), parentPtr(nullptr), height(1), size(1)
+{
+   if (leftChildPtr != nullptr)
+      leftChildPtr->parentPtr = this;
+   if (rightChildPtr != nullptr)
+      rightChildPtr->parentPtr = this;
+   updateSubtreeInfo();
+}  // end constructor
 
 template<class T>
 void BinaryNode<T>::setItem(const T& anItem)
@@ -31,7 +43,19 @@ void BinaryNode<T>::setItem(const T& anItem)
 }  // end setItem
 
 template<class T>
-T BinaryNode<T>::getItem() const
+void BinaryNode<T>::setItem(T&& anItem)
+{
+   item = std::move(anItem);
+}  // end setItem
+
+template<class T>
+const T& BinaryNode<T>::getItem() const
+{
+   return item;
+}  // end getItem
+
+template<class T>
+T& BinaryNode<T>::getItem()
 {
    return item;
 }  // end getItem
@@ -42,27 +66,63 @@ bool BinaryNode<T>::isLeaf() const
    return ((leftChildPtr == nullptr) && (rightChildPtr == nullptr));
 }
 
+template<class T>
+int BinaryNode<T>::getHeight() const
+{
+   return height;
+}  // end getHeight
+
+template<class T>
+int BinaryNode<T>::getSize() const
+{
+   return size;
+}  // end getSize
+
+/** Recomputes the cached height and subtree size from the children. Called
+    whenever a child pointer changes, so both stay correct as long as subtrees
+    are linked bottom-up (which every BinarySearchTree operation does). */
+template<class T>
+void BinaryNode<T>::updateSubtreeInfo()
+{
+   int leftHeight = (leftChildPtr == nullptr) ? 0 : leftChildPtr->height;
+   int rightHeight = (rightChildPtr == nullptr) ? 0 : rightChildPtr->height;
+   height = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+   size = 1 + ((leftChildPtr == nullptr) ? 0 : leftChildPtr->size) + ((rightChildPtr == nullptr) ? 0 : rightChildPtr->size);
+}  // end updateSubtreeInfo
+
 template<class T>
 void BinaryNode<T>::setLeftChildPtr(std::shared_ptr<BinaryNode<T>> leftPtr)
 {
-   leftChildPtr = leftPtr;
+   leftChildPtr = std::move(leftPtr);
+   if (leftChildPtr != nullptr)
+      leftChildPtr->parentPtr = this;
+   updateSubtreeInfo();
 }  // end setLeftChildPtr
 
 template<class T>
 void BinaryNode<T>::setRightChildPtr(std::shared_ptr<BinaryNode<T>> rightPtr)
 {
-   rightChildPtr = rightPtr;
+   rightChildPtr = std::move(rightPtr);
+   if (rightChildPtr != nullptr)
+      rightChildPtr->parentPtr = this;
+   updateSubtreeInfo();
 }  // end setRightChildPtr
 
 template<class T>
-std::shared_ptr<BinaryNode<T>> BinaryNode<T>::getLeftChildPtr() const
+const std::shared_ptr<BinaryNode<T>>& BinaryNode<T>::getLeftChildPtr() const
 {
    return leftChildPtr;
 }  // end getLeftChildPtr		
 
 template<class T>
-std::shared_ptr<BinaryNode<T>> BinaryNode<T>::getRightChildPtr() const
+const std::shared_ptr<BinaryNode<T>>& BinaryNode<T>::getRightChildPtr() const
 {
    return rightChildPtr;
 }  // end getRightChildPtr		
 
+template<class T>
+BinaryNode<T>* BinaryNode<T>::getParentPtr() const
+{
+   return parentPtr;
+}  // end getParentPtr
+
@@ -18,19 +18,30 @@ private:
    T item;           // Data portion
    std::shared_ptr<BinaryNode<T>> leftChildPtr;   // Pointer to left child
    std::shared_ptr<BinaryNode<T>> rightChildPtr;  // Pointer to right child
+   BinaryNode<T>* parentPtr;  // Non-owning pointer to the node that last linked this one as a child; stale at a tree's root
+   int height;       // Number of nodes on the longest path from this node to a leaf
+   int size;         // Number of nodes in the subtree rooted at this node
+
+   void updateSubtreeInfo();
 
 public:
    BinaryNode();
    BinaryNode(const T& anItem);
+   BinaryNode(T&& anItem);
    BinaryNode(const T& anItem, std::shared_ptr<BinaryNode<T>> leftPtr, std::shared_ptr<BinaryNode<T>> rightPtr);
 
    void setItem(const T& anItem);
-   T getItem() const;
+   void setItem(T&& anItem);
+   const T& getItem() const;
+   T& getItem();   // In-place access; callers must not change the item's ordering key
    
    bool isLeaf() const;
+   int getHeight() const;
+   int getSize() const;
 
-   std::shared_ptr<BinaryNode<T>> getLeftChildPtr() const;
-   std::shared_ptr<BinaryNode<T>> getRightChildPtr() const;
+   const std::shared_ptr<BinaryNode<T>>& getLeftChildPtr() const;
+   const std::shared_ptr<BinaryNode<T>>& getRightChildPtr() const;
+   BinaryNode<T>* getParentPtr() const;   // Only meaningful below the root the caller started from
    
    void setLeftChildPtr(std::shared_ptr<BinaryNode<T>> leftPtr);
    void setRightChildPtr(std::shared_ptr<BinaryNode<T>> rightPtr);
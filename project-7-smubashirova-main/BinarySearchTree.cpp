@@ -1,22 +1,23 @@
 #include "BinarySearchTree.hpp"
 #include <vector>
+#include <utility>
 
 
 /*CONSTRUCTRS*/
 
-template <class T>
-BinarySearchTree<T>::BinarySearchTree() : root_ptr_(nullptr)
+template <class T, class BalancePolicy>
+BinarySearchTree<T, BalancePolicy>::BinarySearchTree() : root_ptr_(nullptr)
 {
 } // end default constructor
 
-template <class T>
-BinarySearchTree<T>::BinarySearchTree(const T &root_item)
+template <class T, class BalancePolicy>
+BinarySearchTree<T, BalancePolicy>::BinarySearchTree(const T &root_item)
     : root_ptr_(std::make_shared<BinaryNode<T>>(root_item, nullptr, nullptr))
 {
 } // end constructor
 
-template <class T>
-BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree &another_tree)
+template <class T, class BalancePolicy>
+BinarySearchTree<T, BalancePolicy>::BinarySearchTree(const BinarySearchTree &another_tree)
 {
   root_ptr_ = copyTree(another_tree.root_ptr_); // Call helper method
 } // end copy constructor
@@ -26,31 +27,31 @@ BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree &another_tree)
 /*PUBLIC METHODS*/
 
  /** @return root_ptr_ **/
-template <class T>
-std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::getRoot() const
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::getRoot() const
 {
   return root_ptr_;
 }
 
 /** @return true if the BinarySearchTree is emtpy, false otherwise **/
-template <class T>
-bool BinarySearchTree<T>::isEmpty() const
+template <class T, class BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::isEmpty() const
 {
   return root_ptr_ == nullptr;
 } // end isEmpty
 
 
 /** @return the height of the BST structure as the number of nodes on the longest path from root to leaf**/
-template <class T>
-int BinarySearchTree<T>::getHeight() const
+template <class T, class BalancePolicy>
+int BinarySearchTree<T, BalancePolicy>::getHeight() const
 {
   return this->getHeightHelper(root_ptr_); // Call helper method
 } // end getHeight
 
 
-/** @return the number of Nodes in the BST structure**/
-template <class T>
-int BinarySearchTree<T>::getNumberOfNodes() const
+/** @return the number of Nodes in the BST structure (cached in the root, O(1))**/
+template <class T, class BalancePolicy>
+int BinarySearchTree<T, BalancePolicy>::getNumberOfNodes() const
 {
   return this->getNumberOfNodesHelper(root_ptr_); // Call helper method
 } // end getNumberOfNodes
@@ -63,21 +64,32 @@ int BinarySearchTree<T>::getNumberOfNodes() const
               and all items in its right subtree are > 
               Note: > and < would need to be overloaded for self made data types
     **/
-template <class T>
-void BinarySearchTree<T>::add(const T &new_entry)
+template <class T, class BalancePolicy>
+void BinarySearchTree<T, BalancePolicy>::add(const T &new_entry)
 {
   std::shared_ptr<BinaryNode<T>> new_node_ptr = std::make_shared<BinaryNode<T>>(new_entry);
   root_ptr_ = placeNode(root_ptr_, new_node_ptr);
 } // end add
 
 
+/** @param a new entry to be moved into the BST
+    @post same as add(const T&), but the entry is moved into the new node instead of copied
+    **/
+template <class T, class BalancePolicy>
+void BinarySearchTree<T, BalancePolicy>::add(T &&new_entry)
+{
+  std::shared_ptr<BinaryNode<T>> new_node_ptr = std::make_shared<BinaryNode<T>>(std::move(new_entry));
+  root_ptr_ = placeNode(root_ptr_, new_node_ptr);
+} // end add
+
+
   /** @param entry to be removed from the BST
       @post entry is removed from the BST and retaining its
               BST property, s.t. at any node, all Nodes in
               its left subtree are < the item at that node
               and all items in its right subtree are >**/
-template <class T>
-bool BinarySearchTree<T>::remove(const T &entry)
+template <class T, class BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::remove(const T &entry)
 {
   bool is_successful = false;
   // call may change is_successful
@@ -88,15 +100,167 @@ bool BinarySearchTree<T>::remove(const T &entry)
 
   /** @param entry to be found in the BST
       @return true if entry is found in the BST, false otherwise**/
-template <class T>
-bool BinarySearchTree<T>::contains(const T &entry) const
+template <class T, class BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::contains(const T &entry) const
 {
   return (findNode(root_ptr_, entry) != nullptr);
 } // end contains
 
+
+  /** @param entry to be found in the BST
+      @return a read-only pointer to the item stored in the BST that is equal to entry, nullptr if not found**/
+template <class T, class BalancePolicy>
+const T *BinarySearchTree<T, BalancePolicy>::find(const T &entry) const
+{
+  BinaryNode<T> *node = findNode(root_ptr_, entry);
+  return (node == nullptr) ? nullptr : &node->getItem();
+} // end find
+
+  /** @param entry to be found in the BST
+      @return a pointer to the item stored in the BST that is equal to entry, nullptr if not found.
+              The item may be modified in place as long as its ordering is unchanged.**/
+template <class T, class BalancePolicy>
+T *BinarySearchTree<T, BalancePolicy>::find(const T &entry)
+{
+  // The tree itself is non-const here, so handing out a mutable item is allowed
+  return const_cast<T *>(static_cast<const BinarySearchTree *>(this)->find(entry));
+} // end find
+
+/** @param key the item to rank
+    @return the number of items in the BST that are < key (key need not be in the BST), in O(height) **/
+template <class T, class BalancePolicy>
+int BinarySearchTree<T, BalancePolicy>::rank(const T &key) const
+{
+  return countBelow(key, false);
+} // end rank
+
+/** @param k a 0-based position in sorted order
+    @return a read-only pointer to the k-th smallest item, nullptr if k is out of range, in O(height) **/
+template <class T, class BalancePolicy>
+const T *BinarySearchTree<T, BalancePolicy>::select(int k) const
+{
+  BinaryNode<T> *node = root_ptr_.get();
+  while (node != nullptr)
+  {
+    int left_size = getNumberOfNodesHelper(node->getLeftChildPtr());
+    if (k < left_size)
+      node = node->getLeftChildPtr().get(); // k-th item is in the left subtree
+    else if (k == left_size)
+      return &node->getItem(); // Found
+    else
+    {
+      k -= left_size + 1; // Skip the left subtree and this node
+      node = node->getRightChildPtr().get();
+    }
+  }
+  return nullptr; // k < 0 or k >= getNumberOfNodes()
+} // end select
+
+/** @param k a 0-based position in sorted order
+    @return a pointer to the k-th smallest item, nullptr if k is out of range, in O(height).
+            The item may be modified in place as long as its ordering is unchanged. **/
+template <class T, class BalancePolicy>
+T *BinarySearchTree<T, BalancePolicy>::select(int k)
+{
+  // The tree itself is non-const here, so handing out a mutable item is allowed
+  return const_cast<T *>(static_cast<const BinarySearchTree *>(this)->select(k));
+} // end select
+
+/** @param lo the lower bound (inclusive)
+    @param hi the upper bound (inclusive)
+    @return the number of items x in the BST with lo <= x <= hi, in O(height) **/
+template <class T, class BalancePolicy>
+int BinarySearchTree<T, BalancePolicy>::countInRange(const T &lo, const T &hi) const
+{
+  if (lo > hi)
+    return 0;
+  return countBelow(hi, true) - countBelow(lo, false);
+} // end countInRange
+
+/** @return an iterator to the smallest item, equal to end() if the BST is empty **/
+template <class T, class BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::iterator BinarySearchTree<T, BalancePolicy>::begin() const
+{
+  return iterator(root_ptr_.get());
+} // end begin
+
+/** @return the past-the-end inorder iterator **/
+template <class T, class BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::iterator BinarySearchTree<T, BalancePolicy>::end() const
+{
+  return iterator();
+} // end end
+
+/** @return an iterator to the root, visiting nodes in preorder **/
+template <class T, class BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::preorder_iterator BinarySearchTree<T, BalancePolicy>::preorderBegin() const
+{
+  return preorder_iterator(root_ptr_.get());
+} // end preorderBegin
+
+template <class T, class BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::preorder_iterator BinarySearchTree<T, BalancePolicy>::preorderEnd() const
+{
+  return preorder_iterator();
+} // end preorderEnd
+
+/** @return an iterator to the first node in postorder (the leftmost leaf) **/
+template <class T, class BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::postorder_iterator BinarySearchTree<T, BalancePolicy>::postorderBegin() const
+{
+  return postorder_iterator(root_ptr_.get());
+} // end postorderBegin
+
+template <class T, class BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::postorder_iterator BinarySearchTree<T, BalancePolicy>::postorderEnd() const
+{
+  return postorder_iterator();
+} // end postorderEnd
+
+/** @post the BST is rebuilt into a perfectly balanced shape, s.t. at any node the
+          sizes of the left and right subtrees differ by at most 1. Existing nodes are
+          relinked in place (no items are copied or reallocated), in O(n) **/
+template <class T, class BalancePolicy>
+void BinarySearchTree<T, BalancePolicy>::rebuildBalanced()
+{
+  // Collect the nodes in sorted order with an explicit stack of the
+  // shared_ptrs that own them (the root pointer or a parent's child pointer)
+  std::vector<std::shared_ptr<BinaryNode<T>>> nodes;
+  nodes.reserve(getNumberOfNodes());
+  std::vector<const std::shared_ptr<BinaryNode<T>> *> pending;
+  const std::shared_ptr<BinaryNode<T>> *current = &root_ptr_;
+  while (*current != nullptr || !pending.empty())
+  {
+    while (*current != nullptr)
+    {
+      pending.push_back(current);
+      current = &(*current)->getLeftChildPtr();
+    }
+    nodes.push_back(*pending.back());
+    pending.pop_back();
+    current = &nodes.back()->getRightChildPtr();
+  }
+  root_ptr_ = linkBalanced(nodes, 0, static_cast<int>(nodes.size()) - 1);
+} // end rebuildBalanced
+
+/** @param sorted_items the items to load, in sorted order
+    @pre sorted_items is sorted by the BST ordering
+    @post the BST holds exactly sorted_items (moved in) in a perfectly balanced shape,
+          replacing any previous contents; built bottom-up in O(n) **/
+template <class T, class BalancePolicy>
+void BinarySearchTree<T, BalancePolicy>::buildBalanced(std::vector<T> &&sorted_items)
+{
+  std::vector<std::shared_ptr<BinaryNode<T>>> nodes;
+  nodes.reserve(sorted_items.size());
+  for (T &item : sorted_items)
+    nodes.push_back(std::make_shared<BinaryNode<T>>(std::move(item)));
+  sorted_items.clear();
+  root_ptr_ = linkBalanced(nodes, 0, static_cast<int>(nodes.size()) - 1);
+} // end buildBalanced
+
 /**Display preorder traversal through the BST**/
-template <class T>
-void BinarySearchTree<T>::displayPreorder()
+template <class T, class BalancePolicy>
+void BinarySearchTree<T, BalancePolicy>::displayPreorder()
 {
   preorderHelper(root_ptr_);
   std::cout << std::endl;
@@ -105,8 +269,8 @@ void BinarySearchTree<T>::displayPreorder()
 /**
  * @param: sets the root pointer to the parameter
  */
-template <class T>
-void BinarySearchTree<T>::setRoot(std::shared_ptr<BinaryNode<T>> new_root_ptr)
+template <class T, class BalancePolicy>
+void BinarySearchTree<T, BalancePolicy>::setRoot(std::shared_ptr<BinaryNode<T>> new_root_ptr)
 {
   root_ptr_ = new_root_ptr;
 }
@@ -118,8 +282,8 @@ void BinarySearchTree<T>::setRoot(std::shared_ptr<BinaryNode<T>> new_root_ptr)
 /*PRIVATE METHODS*/
 
 
-template <class T>
-void BinarySearchTree<T>::preorderHelper(std::shared_ptr<BinaryNode<T>> node)
+template <class T, class BalancePolicy>
+void BinarySearchTree<T, BalancePolicy>::preorderHelper(const std::shared_ptr<BinaryNode<T>> &node)
 {
   if (node == nullptr)
   {
@@ -136,8 +300,8 @@ void BinarySearchTree<T>::preorderHelper(std::shared_ptr<BinaryNode<T>> node)
       @post recursively copies every node in the tree pointed to by the parameter pointer
       @return a pointer to the root of the copied subtree
      **/
-template <class T>
-std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::copyTree(const std::shared_ptr<BinaryNode<T>> old_tee_root_ptr) const
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::copyTree(const std::shared_ptr<BinaryNode<T>> &old_tee_root_ptr) const
 {
   std::shared_ptr<BinaryNode<T>> new_tree_ptr;
 
@@ -159,37 +323,63 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::copyTree(const std::shared_p
      @return the height of the BST structure
      as the number of nodes on the longest path
      from root to leaf**/
-template <class T>
-int BinarySearchTree<T>::getHeightHelper(std::shared_ptr<BinaryNode<T>> subtree_ptr) const
+template <class T, class BalancePolicy>
+int BinarySearchTree<T, BalancePolicy>::getHeightHelper(const std::shared_ptr<BinaryNode<T>> &subtree_ptr) const
 {
   if (subtree_ptr == nullptr)
     return 0;
   else
-    return 1 + std::max(getHeightHelper(subtree_ptr->getLeftChildPtr()), getHeightHelper(subtree_ptr->getRightChildPtr()));
+    return subtree_ptr->getHeight(); // Cached in the node and kept current by the child setters
 } // end getHeightHelper
 
 
 /** called by getNumberOfNodes
      @param subtree_ptr a pointer to the root of the current subtree
      @return the number of nodes in the tree**/
-template <class T>
-int BinarySearchTree<T>::getNumberOfNodesHelper(std::shared_ptr<BinaryNode<T>> subtree_ptr) const
+template <class T, class BalancePolicy>
+int BinarySearchTree<T, BalancePolicy>::getNumberOfNodesHelper(const std::shared_ptr<BinaryNode<T>> &subtree_ptr) const
 {
   if (subtree_ptr == nullptr)
     return 0;
   else
-    return 1 + getNumberOfNodesHelper(subtree_ptr->getLeftChildPtr()) + getNumberOfNodesHelper(subtree_ptr->getRightChildPtr());
+    return subtree_ptr->getSize(); // Cached in the node and kept current by the child setters
 } // end getNumberOfNodesHelper
 
 
+/** called by rank and countInRange
+      @param key the bound to compare against
+      @param inclusive whether items equal to key are counted
+      @return the number of items < key (or <= key if inclusive)**/
+template <class T, class BalancePolicy>
+int BinarySearchTree<T, BalancePolicy>::countBelow(const T &key, bool inclusive) const
+{
+  int count = 0;
+  BinaryNode<T> *node = root_ptr_.get();
+  while (node != nullptr)
+  {
+    const T &item = node->getItem();
+    bool counted = inclusive ? !(item > key) : (key > item);
+    if (counted)
+    {
+      // This node and its whole left subtree are below key
+      count += getNumberOfNodesHelper(node->getLeftChildPtr()) + 1;
+      node = node->getRightChildPtr().get();
+    }
+    else
+      node = node->getLeftChildPtr().get();
+  }
+  return count;
+} // end countBelow
+
+
 /** called by add(new_entry)
       @param subtree_ptr a pointer to the subtree in which to place the new node
       @param new_node_ptr a pointer to the new node to be added to the tree
       @post recursively places the new node as a leaf retaining the BST property
       @return a pointer to the root of the subtree in which node was placed
      **/
-template <class T>
-std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::placeNode(std::shared_ptr<BinaryNode<T>> subtree_ptr, std::shared_ptr<BinaryNode<T>> new_node_ptr)
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::placeNode(std::shared_ptr<BinaryNode<T>> subtree_ptr, std::shared_ptr<BinaryNode<T>> new_node_ptr)
 {
   if (subtree_ptr == nullptr)
     return new_node_ptr;
@@ -199,7 +389,7 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::placeNode(std::shared_ptr<Bi
       subtree_ptr->setLeftChildPtr(placeNode(subtree_ptr->getLeftChildPtr(), new_node_ptr));
     else
       subtree_ptr->setRightChildPtr(placeNode(subtree_ptr->getRightChildPtr(), new_node_ptr));
-    return subtree_ptr;
+    return rebalance(subtree_ptr);
   }
 } // end placeNode
 
@@ -207,22 +397,23 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::placeNode(std::shared_ptr<Bi
     /** called by contains
       @param subtree_ptr a pointer to the subtree to be searched
       @param target a reference to the item to be found
-      @return a pointer to the node containing the target, nullptr if not found
+      @return a raw (non-owning) pointer to the node containing the target, nullptr if not found
      **/
-template <class T>
-std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::findNode(std::shared_ptr<BinaryNode<T>> subtree_ptr, const T &target) const
+template <class T, class BalancePolicy>
+BinaryNode<T> *BinarySearchTree<T, BalancePolicy>::findNode(const std::shared_ptr<BinaryNode<T>> &subtree_ptr, const T &target) const
 {
-  // Uses a binary search
-  if (subtree_ptr == nullptr)
-    return subtree_ptr; // Not found
-  else if ((subtree_ptr->getItem() == target))
-    return subtree_ptr; // Found
-  else if (subtree_ptr->getItem() > target)
-    // Search left subtree
-    return findNode(subtree_ptr->getLeftChildPtr(), target);
-  else
-    // Search right subtree
-    return findNode(subtree_ptr->getRightChildPtr(), target);
+  // Uses a binary search; walking raw pointers avoids a refcount update per edge
+  BinaryNode<T> *node = subtree_ptr.get();
+  while (node != nullptr)
+  {
+    if (node->getItem() == target)
+      return node; // Found
+    else if (node->getItem() > target)
+      node = node->getLeftChildPtr().get(); // Search left subtree
+    else
+      node = node->getRightChildPtr().get(); // Search right subtree
+  }
+  return nullptr; // Not found
 } // end findNode
 
 
@@ -232,18 +423,18 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::findNode(std::shared_ptr<Bin
       @post removes the node containing the inorder successor
       @return a pointer to the subtree after inorder successor node has been deleted
      **/
-template <class T>
-std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::removeLeftmostNode(std::shared_ptr<BinaryNode<T>> node_ptr, T &inorder_successor)
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::removeLeftmostNode(std::shared_ptr<BinaryNode<T>> node_ptr, T &inorder_successor)
 {
   if (node_ptr->getLeftChildPtr() == nullptr)
   {
-    inorder_successor = node_ptr->getItem();
+    inorder_successor = std::move(node_ptr->getItem()); // Node is about to be removed
     return removeNode(node_ptr);
   }
   else
   {
     node_ptr->setLeftChildPtr(removeLeftmostNode(node_ptr->getLeftChildPtr(), inorder_successor));
-    return node_ptr;
+    return rebalance(node_ptr);
   } // end if
 } // end removeLeftmostNode
 
@@ -254,8 +445,8 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::removeLeftmostNode(std::shar
       @post removed the node pointed to by parameter retaining the BST property
       @return a pointer to the subtree after node has been removed
      **/
-template <class T>
-std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::removeNode(std::shared_ptr<BinaryNode<T>> node_ptr)
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::removeNode(std::shared_ptr<BinaryNode<T>> node_ptr)
 {
   // Case 1) Node is a leaf - it is deleted
   if (node_ptr->isLeaf())
@@ -278,8 +469,8 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::removeNode(std::shared_ptr<B
     // Traditional way to remove a value in a node with two children
     T new_node_value;
     node_ptr->setRightChildPtr(removeLeftmostNode(node_ptr->getRightChildPtr(), new_node_value));
-    node_ptr->setItem(new_node_value);
-    return node_ptr;
+    node_ptr->setItem(std::move(new_node_value));
+    return rebalance(node_ptr);
   } // end if
 } // end removeNode
 
@@ -290,8 +481,8 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::removeNode(std::shared_ptr<B
       @param success a flag to indicate that item was successfully removed
       @return a pointer to the subtree in which target is found
      **/
-template <class T>
-std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::removeValue(std::shared_ptr<BinaryNode<T>> subtree_ptr, const T target, bool &success)
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::removeValue(std::shared_ptr<BinaryNode<T>> subtree_ptr, const T &target, bool &success)
 {
   if (subtree_ptr == nullptr)
   {
@@ -318,9 +509,87 @@ std::shared_ptr<BinaryNode<T>> BinarySearchTree<T>::removeValue(std::shared_ptr<
       // Search the right subtree
       subtree_ptr->setRightChildPtr(removeValue(subtree_ptr->getRightChildPtr(), target, success));
     }
-    return subtree_ptr;
+    return rebalance(subtree_ptr);
   }
 } // end removeValue
 
 
+/** called on the way back up from placeNode and the remove helpers
+      @param subtree_ptr a pointer to the root of a subtree whose children are already balanced
+      @post if BalancePolicy is self balancing, rotates the subtree so its
+            children's heights differ by at most 1; otherwise does nothing
+      @return a pointer to the root of the (possibly rotated) subtree
+     **/
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::rebalance(std::shared_ptr<BinaryNode<T>> subtree_ptr)
+{
+  if (!BalancePolicy::self_balancing || subtree_ptr == nullptr)
+    return subtree_ptr;
+
+  int balance_factor = getHeightHelper(subtree_ptr->getLeftChildPtr()) - getHeightHelper(subtree_ptr->getRightChildPtr());
+  if (balance_factor > 1)
+  {
+    // Left heavy: a left-right case is first turned into a left-left case
+    std::shared_ptr<BinaryNode<T>> left_ptr = subtree_ptr->getLeftChildPtr();
+    if (getHeightHelper(left_ptr->getLeftChildPtr()) < getHeightHelper(left_ptr->getRightChildPtr()))
+      subtree_ptr->setLeftChildPtr(rotateLeft(left_ptr));
+    return rotateRight(subtree_ptr);
+  }
+  else if (balance_factor < -1)
+  {
+    // Right heavy: a right-left case is first turned into a right-right case
+    std::shared_ptr<BinaryNode<T>> right_ptr = subtree_ptr->getRightChildPtr();
+    if (getHeightHelper(right_ptr->getRightChildPtr()) < getHeightHelper(right_ptr->getLeftChildPtr()))
+      subtree_ptr->setRightChildPtr(rotateRight(right_ptr));
+    return rotateLeft(subtree_ptr);
+  }
+  return subtree_ptr;
+} // end rebalance
+
+
+/** @param subtree_ptr a pointer to a subtree with a left child
+      @post the left child becomes the root of the subtree
+      @return a pointer to the new root of the subtree
+     **/
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::rotateRight(std::shared_ptr<BinaryNode<T>> subtree_ptr)
+{
+  std::shared_ptr<BinaryNode<T>> new_root_ptr = subtree_ptr->getLeftChildPtr();
+  subtree_ptr->setLeftChildPtr(new_root_ptr->getRightChildPtr()); // Old root is re-linked (and its height updated) first
+  new_root_ptr->setRightChildPtr(subtree_ptr);
+  return new_root_ptr;
+} // end rotateRight
+
 
+/** @param subtree_ptr a pointer to a subtree with a right child
+      @post the right child becomes the root of the subtree
+      @return a pointer to the new root of the subtree
+     **/
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::rotateLeft(std::shared_ptr<BinaryNode<T>> subtree_ptr)
+{
+  std::shared_ptr<BinaryNode<T>> new_root_ptr = subtree_ptr->getRightChildPtr();
+  subtree_ptr->setRightChildPtr(new_root_ptr->getLeftChildPtr()); // Old root is re-linked (and its height updated) first
+  new_root_ptr->setLeftChildPtr(subtree_ptr);
+  return new_root_ptr;
+} // end rotateLeft
+
+
+/** called by rebuildBalanced
+      @param nodes the nodes of the tree in sorted (inorder) order
+      @param start the first index of the range to link
+      @param end the last index of the range to link
+      @post the middle node of the range becomes the root of a balanced subtree of the range
+      @return a pointer to the root of the rebuilt subtree, nullptr if the range is empty
+     **/
+template <class T, class BalancePolicy>
+std::shared_ptr<BinaryNode<T>> BinarySearchTree<T, BalancePolicy>::linkBalanced(const std::vector<std::shared_ptr<BinaryNode<T>>> &nodes, int start, int end)
+{
+  if (start > end)
+    return nullptr;
+  int mid = start + (end - start) / 2;
+  // Children are linked after their subtrees are built, so cached heights and sizes stay correct
+  nodes[mid]->setLeftChildPtr(linkBalanced(nodes, start, mid - 1));
+  nodes[mid]->setRightChildPtr(linkBalanced(nodes, mid + 1, end));
+  return nodes[mid];
+} // end linkBalanced
@@ -2,12 +2,34 @@
 #define BINARY_SEARCH_TREE_
 
 #include "BinaryNode.hpp"
+#include "BinaryTreeIterator.hpp"
 #include <iostream>
+#include <vector>
 
-template <class T>
+/** Balancing policies for BinarySearchTree.
+    NoBalancing keeps the plain BST behaviour. AVLBalancing rotates on every
+    add/remove so that, at any node, the heights of the left and right
+    subtrees differ by at most 1 and getHeight() stays O(log n). **/
+struct NoBalancing
+{
+  static const bool self_balancing = false;
+};
+
+struct AVLBalancing
+{
+  static const bool self_balancing = true;
+};
+
+template <class T, class BalancePolicy = NoBalancing>
 class BinarySearchTree
 {
 public:
+  /*Iterators: range-for and the STL algorithms walk the tree in sorted (inorder) order*/
+  typedef BinaryTreeIterator<T, TraversalOrder::Inorder> iterator;
+  typedef BinaryTreeIterator<T, TraversalOrder::Inorder> const_iterator;
+  typedef BinaryTreeIterator<T, TraversalOrder::Preorder> preorder_iterator;
+  typedef BinaryTreeIterator<T, TraversalOrder::Postorder> postorder_iterator;
+
   /*Constructors*/
   BinarySearchTree();                                     //default constructor
   BinarySearchTree(const T &root_item);                   //parameterized constructor
@@ -22,7 +44,7 @@ public:
   /** @return the height of the BST structure as the number of nodes on the longest path from root to leaf**/
   int getHeight() const;
 
-  /** @return the number of Nodes in the BST structure**/
+  /** @return the number of Nodes in the BST structure (cached in the root, O(1))**/
   int getNumberOfNodes() const;
 
   /** @param a new entry to be added to the BST
@@ -34,6 +56,11 @@ public:
     **/
   void add(const T &new_entry);
 
+  /** @param a new entry to be moved into the BST
+      @post same as add(const T&), but the entry is moved into the new node instead of copied
+    **/
+  void add(T &&new_entry);
+
   /** @param entry to be removed from the BST
       @post entry is removed from the BST and retaining its
               BST property, s.t. at any node, all Nodes in
@@ -46,6 +73,58 @@ public:
       @return true if entry is found in the BST, false otherwise**/
   bool contains(const T &entry) const;
 
+  /** @param entry to be found in the BST
+      @return a read-only pointer to the item stored in the BST that is equal to entry, nullptr if not found**/
+  const T *find(const T &entry) const;
+
+  /** @param entry to be found in the BST
+      @return a pointer to the item stored in the BST that is equal to entry, nullptr if not found.
+              The item may be modified in place as long as its ordering is unchanged.**/
+  T *find(const T &entry);
+
+  /** @param key the item to rank
+      @return the number of items in the BST that are < key (key need not be in the BST), in O(height) **/
+  int rank(const T &key) const;
+
+  /** @param k a 0-based position in sorted order
+      @return a read-only pointer to the k-th smallest item, nullptr if k is out of range, in O(height) **/
+  const T *select(int k) const;
+
+  /** @param k a 0-based position in sorted order
+      @return a pointer to the k-th smallest item, nullptr if k is out of range, in O(height).
+              The item may be modified in place as long as its ordering is unchanged. **/
+  T *select(int k);
+
+  /** @param lo the lower bound (inclusive)
+      @param hi the upper bound (inclusive)
+      @return the number of items x in the BST with lo <= x <= hi, in O(height) **/
+  int countInRange(const T &lo, const T &hi) const;
+
+  /** @return an iterator to the smallest item, equal to end() if the BST is empty **/
+  iterator begin() const;
+
+  /** @return the past-the-end inorder iterator **/
+  iterator end() const;
+
+  /** @return an iterator to the root, visiting nodes in preorder **/
+  preorder_iterator preorderBegin() const;
+  preorder_iterator preorderEnd() const;
+
+  /** @return an iterator to the first node in postorder (the leftmost leaf) **/
+  postorder_iterator postorderBegin() const;
+  postorder_iterator postorderEnd() const;
+
+  /** @post the BST is rebuilt into a perfectly balanced shape, s.t. at any node the
+            sizes of the left and right subtrees differ by at most 1. Existing nodes are
+            relinked in place (no items are copied or reallocated), in O(n) **/
+  void rebuildBalanced();
+
+  /** @param sorted_items the items to load, in sorted order
+      @pre sorted_items is sorted by the BST ordering
+      @post the BST holds exactly sorted_items (moved in) in a perfectly balanced shape,
+            replacing any previous contents; built bottom-up in O(n) **/
+  void buildBalanced(std::vector<T> &&sorted_items);
+
   /**Display preorder traversal through the BST**/
   void displayPreorder();
 
@@ -62,7 +141,7 @@ private:
       @post recursively copies every node in the tree pointed to by the parameter pointer
       @return a pointer to the root of the copied subtree
      **/
-  std::shared_ptr<BinaryNode<T>> copyTree(const std::shared_ptr<BinaryNode<T>> old_tee_root_ptr) const;
+  std::shared_ptr<BinaryNode<T>> copyTree(const std::shared_ptr<BinaryNode<T>> &old_tee_root_ptr) const;
 
 
   /** called by getHeight
@@ -70,12 +149,18 @@ private:
      @return the height of the BST structure
      as the number of nodes on the longest path
      from root to leaf**/
-  int getHeightHelper(std::shared_ptr<BinaryNode<T>> subtree_ptr) const;
+  int getHeightHelper(const std::shared_ptr<BinaryNode<T>> &subtree_ptr) const;
 
   /** called by getNumberOfNodes
      @param subtree_ptr a pointer to the root of the current subtree
      @return the number of nodes in the tree**/
-  int getNumberOfNodesHelper(std::shared_ptr<BinaryNode<T>> subtree_ptr) const;
+  int getNumberOfNodesHelper(const std::shared_ptr<BinaryNode<T>> &subtree_ptr) const;
+
+  /** called by rank and countInRange
+      @param key the bound to compare against
+      @param inclusive whether items equal to key are counted
+      @return the number of items < key (or <= key if inclusive)**/
+  int countBelow(const T &key, bool inclusive) const;
 
   /** called by add(new_entry)
       @param subtree_ptr a pointer to the subtree in which to place the new node
@@ -92,7 +177,7 @@ private:
       @param success a flag to indicate that item was successfully removed
       @return a pointer to the subtree in which target is found
      **/
-  std::shared_ptr<BinaryNode<T>> removeValue(std::shared_ptr<BinaryNode<T>> subtree_ptr, const T target, bool &success);
+  std::shared_ptr<BinaryNode<T>> removeValue(std::shared_ptr<BinaryNode<T>> subtree_ptr, const T &target, bool &success);
 
   /** called by removeValue
       @param node_ptr a pointer to the node to be removed
@@ -113,12 +198,41 @@ private:
   /** called by contains
       @param subtree_ptr a pointer to the subtree to be searched
       @param target a reference to the item to be found
-      @return a pointer to the node containing the target, nullptr if not found
+      @return a raw (non-owning) pointer to the node containing the target, nullptr if not found
+     **/
+  BinaryNode<T> *findNode(const std::shared_ptr<BinaryNode<T>> &subtree_ptr, const T &target) const;
+
+  /** called on the way back up from placeNode and the remove helpers
+      @param subtree_ptr a pointer to the root of a subtree whose children are already balanced
+      @post if BalancePolicy is self balancing, rotates the subtree so its
+            children's heights differ by at most 1; otherwise does nothing
+      @return a pointer to the root of the (possibly rotated) subtree
+     **/
+  std::shared_ptr<BinaryNode<T>> rebalance(std::shared_ptr<BinaryNode<T>> subtree_ptr);
+
+  /** @param subtree_ptr a pointer to a subtree with a left child
+      @post the left child becomes the root of the subtree
+      @return a pointer to the new root of the subtree
+     **/
+  std::shared_ptr<BinaryNode<T>> rotateRight(std::shared_ptr<BinaryNode<T>> subtree_ptr);
+
+  /** @param subtree_ptr a pointer to a subtree with a right child
+      @post the right child becomes the root of the subtree
+      @return a pointer to the new root of the subtree
+     **/
+  std::shared_ptr<BinaryNode<T>> rotateLeft(std::shared_ptr<BinaryNode<T>> subtree_ptr);
+
+  /** called by rebuildBalanced
+      @param nodes the nodes of the tree in sorted (inorder) order
+      @param start the first index of the range to link
+      @param end the last index of the range to link
+      @post the middle node of the range becomes the root of a balanced subtree of the range
+      @return a pointer to the root of the rebuilt subtree, nullptr if the range is empty
      **/
-  std::shared_ptr<BinaryNode<T>> findNode(std::shared_ptr<BinaryNode<T>> subtree_ptr, const T &target) const;
+  std::shared_ptr<BinaryNode<T>> linkBalanced(const std::vector<std::shared_ptr<BinaryNode<T>>> &nodes, int start, int end);
 
   //display helpers
-  void preorderHelper(std::shared_ptr<BinaryNode<T>> node);
+  void preorderHelper(const std::shared_ptr<BinaryNode<T>> &node);
 
 
 };
@@ -0,0 +1,143 @@
+#include "BinaryTreeIterator.hpp"
+
+
+/*CONSTRUCTRS*/
+
+template <class T, TraversalOrder Order>
+BinaryTreeIterator<T, Order>::BinaryTreeIterator() : root_(nullptr), current_(nullptr)
+{
+} // end default constructor
+
+template <class T, TraversalOrder Order>
+BinaryTreeIterator<T, Order>::BinaryTreeIterator(BinaryNode<T> *root) : root_(root), current_(nullptr)
+{
+  if (root == nullptr)
+    return;
+  if (Order == TraversalOrder::Inorder)
+    current_ = leftmost(root);
+  else if (Order == TraversalOrder::Preorder)
+    current_ = root;
+  else
+    current_ = firstPostorder(root);
+} // end constructor
+
+
+
+/*PUBLIC METHODS*/
+
+template <class T, TraversalOrder Order>
+typename BinaryTreeIterator<T, Order>::reference BinaryTreeIterator<T, Order>::operator*() const
+{
+  return static_cast<const BinaryNode<T> *>(current_)->getItem();
+} // end operator*
+
+template <class T, TraversalOrder Order>
+typename BinaryTreeIterator<T, Order>::pointer BinaryTreeIterator<T, Order>::operator->() const
+{
+  return &**this;
+} // end operator->
+
+template <class T, TraversalOrder Order>
+BinaryTreeIterator<T, Order> &BinaryTreeIterator<T, Order>::operator++()
+{
+  BinaryNode<T> *node = current_;
+  if (Order == TraversalOrder::Inorder)
+  {
+    // Next is the leftmost node of the right subtree, otherwise the first
+    // ancestor reached from its left side
+    if (node->getRightChildPtr() != nullptr)
+    {
+      current_ = leftmost(node->getRightChildPtr().get());
+      return *this;
+    }
+    while (node != root_ && node->getParentPtr()->getRightChildPtr().get() == node)
+      node = node->getParentPtr();
+    current_ = (node == root_) ? nullptr : node->getParentPtr();
+  }
+  else if (Order == TraversalOrder::Preorder)
+  {
+    // Children first, left before right; otherwise the right subtree of the
+    // first ancestor reached from its left side that has one
+    if (node->getLeftChildPtr() != nullptr)
+    {
+      current_ = node->getLeftChildPtr().get();
+      return *this;
+    }
+    if (node->getRightChildPtr() != nullptr)
+    {
+      current_ = node->getRightChildPtr().get();
+      return *this;
+    }
+    current_ = nullptr;
+    while (node != root_)
+    {
+      BinaryNode<T> *parent = node->getParentPtr();
+      if (parent->getLeftChildPtr().get() == node && parent->getRightChildPtr() != nullptr)
+      {
+        current_ = parent->getRightChildPtr().get();
+        break;
+      }
+      node = parent;
+    }
+  }
+  else if (node == root_)
+  {
+    current_ = nullptr; // Postorder ends at the root
+  }
+  else
+  {
+    // Postorder: after a left child comes its parent's right subtree, otherwise the parent itself
+    BinaryNode<T> *parent = node->getParentPtr();
+    if (parent->getLeftChildPtr().get() == node && parent->getRightChildPtr() != nullptr)
+      current_ = firstPostorder(parent->getRightChildPtr().get());
+    else
+      current_ = parent;
+  }
+  return *this;
+} // end operator++
+
+template <class T, TraversalOrder Order>
+BinaryTreeIterator<T, Order> BinaryTreeIterator<T, Order>::operator++(int)
+{
+  BinaryTreeIterator<T, Order> previous = *this;
+  ++(*this);
+  return previous;
+} // end operator++
+
+template <class T, TraversalOrder Order>
+bool BinaryTreeIterator<T, Order>::operator==(const BinaryTreeIterator &other) const
+{
+  return current_ == other.current_;
+} // end operator==
+
+template <class T, TraversalOrder Order>
+bool BinaryTreeIterator<T, Order>::operator!=(const BinaryTreeIterator &other) const
+{
+  return !(*this == other);
+} // end operator!=
+
+
+
+/*PRIVATE METHODS*/
+
+template <class T, TraversalOrder Order>
+BinaryNode<T> *BinaryTreeIterator<T, Order>::leftmost(BinaryNode<T> *node)
+{
+  while (node->getLeftChildPtr() != nullptr)
+    node = node->getLeftChildPtr().get();
+  return node;
+} // end leftmost
+
+template <class T, TraversalOrder Order>
+BinaryNode<T> *BinaryTreeIterator<T, Order>::firstPostorder(BinaryNode<T> *node)
+{
+  // Prefer the left child, fall back to the right, and stop at a leaf
+  while (!node->isLeaf())
+  {
+    if (node->getLeftChildPtr() != nullptr)
+      node = node->getLeftChildPtr().get();
+    else
+      node = node->getRightChildPtr().get();
+  }
+  return node;
+} // end firstPostorder
@@ -0,0 +1,65 @@
+#ifndef BINARY_TREE_ITERATOR_
+#define BINARY_TREE_ITERATOR_
+
+#include "BinaryNode.hpp"
+#include <cstddef>
+#include <iterator>
+
+/** The order in which a BinaryTreeIterator visits the nodes of a tree **/
+enum class TraversalOrder
+{
+  Inorder,
+  Preorder,
+  Postorder
+};
+
+/** A read-only STL forward iterator over the items of a linked binary tree.
+    The traversal is iterative: the iterator holds only the root and the
+    current node as raw pointers and climbs back up through each node's parent
+    pointer, so a walk involves no recursion, no allocation, no std::function
+    and no shared_ptr refcounting, and copying an iterator is two pointer copies.
+    Any add or remove on the tree invalidates its iterators. **/
+template <class T, TraversalOrder Order = TraversalOrder::Inorder>
+class BinaryTreeIterator
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T *;
+  using reference = const T &;
+
+  /** Default constructor.
+      @post the iterator is the past-the-end iterator **/
+  BinaryTreeIterator();
+
+  /** @param root a pointer to the root of the tree to be traversed (may be nullptr)
+      @post the iterator refers to the first node in Order **/
+  explicit BinaryTreeIterator(BinaryNode<T> *root);
+
+  /** @pre the iterator is not past-the-end
+      @return a reference to the item at the current node **/
+  reference operator*() const;
+  pointer operator->() const;
+
+  /** @post the iterator refers to the next node in Order, or is past-the-end **/
+  BinaryTreeIterator &operator++();
+  BinaryTreeIterator operator++(int);
+
+  /** @return true if both iterators refer to the same node (or both are past-the-end) **/
+  bool operator==(const BinaryTreeIterator &other) const;
+  bool operator!=(const BinaryTreeIterator &other) const;
+
+private:
+  BinaryNode<T> *root_;    // Root of the traversed tree; the walk never climbs above it
+  BinaryNode<T> *current_; // Current node, nullptr when past-the-end
+
+  /** @return the leftmost node of the subtree rooted at node **/
+  static BinaryNode<T> *leftmost(BinaryNode<T> *node);
+
+  /** @return the first node of the subtree rooted at node in postorder **/
+  static BinaryNode<T> *firstPostorder(BinaryNode<T> *node);
+};
+
+#include "BinaryTreeIterator.cpp"
+#endif
@@ -10,6 +10,13 @@
 */
 
 #include "RecipeBook.hpp"
+#include <cctype> // for isspace, isdigit
+#include <charconv> // for from_chars
+#include <climits> // for INT_MIN, INT_MAX
+#include <fcntl.h> // for open
+#include <sys/mman.h> // for mmap
+#include <sys/stat.h> // for fstat
+#include <unistd.h> // for close
 
 /**
     * Default constructor.
@@ -60,7 +67,7 @@ bool Recipe::operator>(const Recipe &other) const {
     * Default Constructor.
     * @post: Initializes an empty RecipeBook.
 */
-RecipeBook::RecipeBook() : BinarySearchTree<Recipe>() {} // Call the default constructor of the base class BinarySearchTree<Recipe>
+RecipeBook::RecipeBook() : BinarySearchTree<Recipe, AVLBalancing>() {} // Call the default constructor of the base class BinarySearchTree<Recipe, AVLBalancing>
 
 /**
     * Parameterized Constructor.
@@ -70,24 +77,35 @@ RecipeBook::RecipeBook() : BinarySearchTree<Recipe>() {} // Call the default con
     * name,difficulty_level,description,mastered
     * Ignore the first line. Each subsequent line represents a Recipe to be added to the RecipeBook.
 */
-RecipeBook::RecipeBook(const std::string &filename) : BinarySearchTree<Recipe>() {
-    std::ifstream file(filename);
-    std::string line;
-    std::getline(file, line); // Ignore the first line (header)
-    while (std::getline(file, line)) { // Read each line from the file
-        std::stringstream ss(line); // Create a stringstream from the line
-        std::string name, description, mastered_str;
-        int difficulty_level;
-        bool mastered;
-        std::getline(ss, name, ','); //Extract the name
-        ss >> difficulty_level; //Extract the difficulty level
-        ss.ignore(); // Ignore the comma
-        std::getline(ss, description, ','); //Extract the description
-        std::getline(ss, mastered_str); //Extract the mastered status
-        mastered = (mastered_str == "true");
-        Recipe recipe(name, difficulty_level, description, mastered); // Create a Recipe object
-        addRecipe(recipe); // Add the Recipe to the RecipeBook
+RecipeBook::RecipeBook(const std::string &filename) : BinarySearchTree<Recipe, AVLBalancing>() {
+    std::vector<Recipe> recipes; // Rows are collected first and bulk-loaded
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return; // File could not be opened, the RecipeBook stays empty
+    struct stat file_stat;
+    bool parsed = false;
+    if (fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+        size_t length = static_cast<size_t>(file_stat.st_size);
+        // Map the whole file and parse it in place
+        void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            madvise(mapped, length, MADV_SEQUENTIAL);
+            parseCsv(static_cast<const char*>(mapped), length, recipes);
+            munmap(mapped, length);
+            parsed = true;
+        }
+    }
+    if (!parsed) {
+        // Not mappable (a pipe or FIFO, a special file, or one that reports size 0): read it through the open descriptor
+        std::string contents;
+        char buffer[65536];
+        ssize_t count;
+        while ((count = read(fd, buffer, sizeof(buffer))) > 0) {
+            contents.append(buffer, static_cast<size_t>(count));
+        }
+        parseCsv(contents.data(), contents.size(), recipes);
     }
+    close(fd);
+    bulkLoad(std::move(recipes)); // Build the RecipeBook from all rows at once
 }
 
 // Find a Recipe Function
@@ -96,17 +114,40 @@ RecipeBook::RecipeBook(const std::string &filename) : BinarySearchTree<Recipe>()
     * @param name A const reference to a string representing the name of the Recipe.
     * @return A pointer to the node containing the Recipe with the given difficulty level, or nullptr if not found.
 */
-Recipe* RecipeBook::findRecipe(const std::string &name) const {
-    Recipe* foundRecipe = nullptr;
-    // Define the lambda for inorder traversal
-    auto visit = [&](const Recipe& r) {
-        if (r.name_ == name) {
-            foundRecipe = const_cast<Recipe*>(&r);  // Found, return non-const pointer
+const Recipe* RecipeBook::findRecipe(const std::string &name) const {
+    // The tree is ordered by name_, so descend from the root and stop at the match
+    const BinaryNode<Recipe>* node = getRoot().get();
+    while (node != nullptr) {
+        const Recipe& r = node->getItem();
+        if (name == r.name_) {
+            return &r;  // Found, return a pointer into the node
         }
-    };
-    // Perform inorder traversal to find the recipe
-    inorderTraversal(visit);
-    return foundRecipe; // Return the found recipe or nullptr
+        node = (name < r.name_) ? node->getLeftChildPtr().get() : node->getRightChildPtr().get();
+    }
+    return nullptr; // Recipe not found
+}
+
+/**
+    * Finds the k-th Recipe in name order.
+    * @param k A 0-based position in name order.
+    * @return A read-only pointer to the k-th Recipe, or nullptr if k is out of range.
+*/
+const Recipe* RecipeBook::select(int k) const {
+    return BinarySearchTree<Recipe, AVLBalancing>::select(k);
+}
+
+/**
+    * Finds the Recipe with the same name as entry.
+    * @param entry A const reference to a Recipe whose name_ is looked up.
+    * @return A read-only pointer to the stored Recipe, or nullptr if not found.
+*/
+const Recipe* RecipeBook::find(const Recipe &entry) const {
+    return BinarySearchTree<Recipe, AVLBalancing>::find(entry);
+}
+
+// helper function to find a Recipe by name for an in-place update; the node it lives in is not const
+Recipe* RecipeBook::findMutableRecipe(const std::string &name) {
+    return const_cast<Recipe*>(findRecipe(name));
 }
 
 // Add a Recipe Function
@@ -121,7 +162,26 @@ bool RecipeBook::addRecipe(const Recipe &recipe) {
     if (findRecipe(recipe.name_) != nullptr) {
         return false;  // Recipe already exists, cannot add it
     }
-    BinarySearchTree<Recipe>::add(recipe);  // Add the recipe to the BST
+    if (!recipe.mastered_) {
+        updateUnmastered(recipe.difficulty_level_, 1);  // Track the new unmastered recipe
+    }
+    BinarySearchTree<Recipe, AVLBalancing>::add(recipe);  // Add the recipe to the BST
+    return true;
+}
+
+/**
+    * Adds a Recipe to the tree, moving it into the new node instead of copying it.
+    * @param recipe An rvalue reference to a Recipe object.
+    * @return: True if the Recipe was successfully added; false if a Recipe with the same name already exists.
+*/
+bool RecipeBook::addRecipe(Recipe &&recipe) {
+    if (findRecipe(recipe.name_) != nullptr) {
+        return false;  // Recipe already exists, cannot add it
+    }
+    if (!recipe.mastered_) {
+        updateUnmastered(recipe.difficulty_level_, 1);  // Track the new unmastered recipe
+    }
+    BinarySearchTree<Recipe, AVLBalancing>::add(std::move(recipe));  // Move the recipe into the BST
     return true;
 }
 
@@ -133,9 +193,12 @@ bool RecipeBook::addRecipe(const Recipe &recipe) {
     * @return: True if the Recipe was successfully removed; false otherwise.
 */
 bool RecipeBook::removeRecipe(const std::string &name) {
-    Recipe* recipe = findRecipe(name); // Find the recipe by name
+    const Recipe* recipe = findRecipe(name); // Find the recipe by name
     if (recipe) { //If the recipe is found
-        return BinarySearchTree<Recipe>::remove(*recipe); // Remove the recipe from the tree
+        if (!recipe->mastered_) {
+            updateUnmastered(recipe->difficulty_level_, -1);  // It no longer counts toward mastery points
+        }
+        return BinarySearchTree<Recipe, AVLBalancing>::remove(*recipe); // Remove the recipe from the tree
     }
     return false; // Return false if the recipe was not found
 }
@@ -146,9 +209,9 @@ bool RecipeBook::removeRecipe(const std::string &name) {
     * @post: The tree is emptied, and all nodes are deallocated.
 */
 void RecipeBook::clear() {
-    while (!isEmpty()) { // While the tree is not empty
-        remove(getRoot()->getItem()); // Remove the root item
-    }
+    setRoot(nullptr); // Drop the root; the nodes are deallocated as their shared_ptrs are released
+    unmastered_index_.clear(); // No recipes left to count
+    difficulty_levels_.clear();
 }
 
 // Calculatemasterypoints Function
@@ -161,20 +224,32 @@ void RecipeBook::clear() {
 */
 int RecipeBook::calculateMasteryPoints(const std::string &name) const {
     // Locate the recipe by name
-    Recipe* recipe = findRecipe(name);
+    const Recipe* recipe = findRecipe(name);
     if (!recipe) return -1;  // Recipe not found
     if (recipe->mastered_) return 0;  // Recipe is already mastered
-    int masteryPoints = 0;
-    // Perform an inorder traversal to count unmastered recipes with lower difficulty levels
-    auto visit = [&masteryPoints, &recipe](const Recipe& r) {
-        if (r.difficulty_level_ < recipe->difficulty_level_ && !r.mastered_) {
-            masteryPoints++;
-        }
-    };
-    inorderTraversal(visit); // Traverse the tree in inorder
+    // Count unmastered recipes with lower difficulty levels using the difficulty index
+    int masteryPoints = countUnmasteredBelow(recipe->difficulty_level_);
     return masteryPoints + 1;  // Add 1 for the current recipe
 }
 
+// Setmastered Function
+/**
+    * Marks a Recipe as mastered or unmastered.
+    * @param name A const reference to a string representing the name of the Recipe.
+    * @param mastered The new mastery status.
+    * @post: The Recipe's mastered_ is updated, and so is the difficulty index used by calculateMasteryPoints.
+    * @return: True if the Recipe was found; false otherwise.
+*/
+bool RecipeBook::setMastered(const std::string &name, bool mastered) {
+    Recipe* recipe = findMutableRecipe(name);
+    if (!recipe) return false;  // Recipe not found
+    if (recipe->mastered_ != mastered) {
+        updateUnmastered(recipe->difficulty_level_, mastered ? -1 : 1);
+        recipe->mastered_ = mastered;
+    }
+    return true;
+}
+
 // Balance Function
 /**
     * Balances the tree.
@@ -182,18 +257,162 @@ int RecipeBook::calculateMasteryPoints(const std::string &name) const {
     * @note: You may implement this by performing an inorder traversal to get sorted Recipes and rebuilding the tree.
 */
 void RecipeBook::balance() {
-    std::vector<Recipe> recipes; // Vector to store recipes in sorted order
-    inorderTraversal([&recipes](const Recipe& r) { recipes.push_back(r); }); // Store recipes in inorder
-    clear(); // Clear the current tree
-    balanceHelper(recipes, 0, recipes.size() - 1); // Rebuild the tree in balanced form
+    rebuildBalanced(); // Relink the existing nodes around the middle recipe in O(n); the difficulty index is unaffected
+}
+
+// Parses the CSV text in data (header line included) and appends one Recipe per row.
+// Fields are scanned as string_views over the buffer and copied once, straight into the Recipe.
+void RecipeBook::parseCsv(const char* data, size_t length, std::vector<Recipe>& recipes) {
+    size_t pos = 0;
+    std::string scratch;
+    skipCsvRecord(data, length, pos); // Ignore the first line (header)
+    while (pos < length) {
+        if (data[pos] == '\n' || data[pos] == '\r') { // Skip blank lines
+            pos++;
+            continue;
+        }
+        Recipe& recipe = recipes.emplace_back();
+        std::string_view field = readCsvField(data, length, pos, scratch); //Extract the name
+        recipe.name_.assign(field.data(), field.size());
+        field = readCsvField(data, length, pos, scratch); //Extract the difficulty level
+        while (!field.empty() && std::isspace(static_cast<unsigned char>(field.front()))) field.remove_prefix(1); // >> skipped any whitespace
+        if (field.size() > 1 && field.front() == '+' && std::isdigit(static_cast<unsigned char>(field[1]))) field.remove_prefix(1); // >> accepted a '+' sign, from_chars does not
+        std::errc error = std::from_chars(field.data(), field.data() + field.size(), recipe.difficulty_level_).ec;
+        if (error == std::errc::result_out_of_range) {
+            recipe.difficulty_level_ = (field.front() == '-') ? INT_MIN : INT_MAX; // >> saturated
+        } else if (error != std::errc()) {
+            recipe.difficulty_level_ = 0; // Not a number
+        }
+        field = readCsvField(data, length, pos, scratch); //Extract the description
+        recipe.description_.assign(field.data(), field.size());
+        field = readCsvField(data, length, pos, scratch); //Extract the mastered status
+        recipe.mastered_ = (field == "true");
+        skipCsvRecord(data, length, pos); // Ignore any extra fields
+    }
+}
+
+// Reads the CSV field starting at pos and advances pos past it and its trailing comma (but not past
+// the end of the line). A quoted field may contain commas, newlines and "" escapes; the returned view
+// points into data, or into scratch when escapes had to be removed.
+std::string_view RecipeBook::readCsvField(const char* data, size_t length, size_t& pos, std::string& scratch) {
+    std::string_view field;
+    if (pos < length && data[pos] == '"') {
+        size_t start = ++pos;
+        bool escaped = false;
+        while (pos < length) {
+            if (data[pos] == '"') {
+                if (pos + 1 < length && data[pos + 1] == '"') { // "" is a literal quote
+                    escaped = true;
+                    pos += 2;
+                    continue;
+                }
+                break; // Closing quote
+            }
+            pos++;
+        }
+        field = std::string_view(data + start, pos - start);
+        if (pos < length) pos++; // Skip the closing quote
+        if (escaped) {
+            scratch.clear();
+            for (size_t i = 0; i < field.size(); i++) {
+                scratch.push_back(field[i]);
+                if (field[i] == '"') i++; // Keep one quote of each pair
+            }
+            field = scratch;
+        }
+        while (pos < length && data[pos] != ',' && data[pos] != '\n' && data[pos] != '\r') pos++; // Ignore text after the closing quote
+    } else {
+        size_t start = pos;
+        while (pos < length && data[pos] != ',' && data[pos] != '\n' && data[pos] != '\r') pos++;
+        field = std::string_view(data + start, pos - start);
+    }
+    if (pos < length && data[pos] == ',') pos++; // Skip the separator
+    return field;
 }
 
-void RecipeBook::balanceHelper(const std::vector<Recipe>& recipes, int start, int end) {
-    if (start > end) return;  // Base case: no more elements to add
-    int mid = start + (end - start) / 2;  // Prevent potential overflow
-    addRecipe(recipes[mid]);  // Add the middle element
-    balanceHelper(recipes, start, mid - 1);  // Recur for left subarray
-    balanceHelper(recipes, mid + 1, end);    // Recur for right subarray
+// Advances pos past the end of the current line (CR, LF or CRLF), honoring quoted fields
+void RecipeBook::skipCsvRecord(const char* data, size_t length, size_t& pos) {
+    std::string scratch;
+    while (pos < length && data[pos] != '\n' && data[pos] != '\r') {
+        readCsvField(data, length, pos, scratch);
+    }
+    if (pos < length && data[pos] == '\r') pos++;
+    if (pos < length && data[pos] == '\n') pos++;
+}
+
+// Replaces the contents with recipes: sorts them by name unless they already are, keeps the first
+// Recipe with each name (matching addRecipe), and builds a perfectly balanced tree bottom-up
+void RecipeBook::bulkLoad(std::vector<Recipe>&& recipes) {
+    if (!std::is_sorted(recipes.begin(), recipes.end())) {
+        std::stable_sort(recipes.begin(), recipes.end()); // Stable, so the first row with a name stays first
+    }
+    recipes.erase(std::unique(recipes.begin(), recipes.end()), recipes.end()); // Recipe::operator== compares names
+    buildUnmasteredIndex(recipes);
+    buildBalanced(std::move(recipes));
+}
+
+// Collects the distinct difficulty levels of recipes and counts the unmastered ones per level,
+// then turns the per-level counts into a Fenwick tree in place
+void RecipeBook::buildUnmasteredIndex(const std::vector<Recipe>& recipes) {
+    difficulty_levels_.clear();
+    for (const Recipe& r : recipes) {
+        difficulty_levels_.push_back(r.difficulty_level_);
+    }
+    std::sort(difficulty_levels_.begin(), difficulty_levels_.end());
+    difficulty_levels_.erase(std::unique(difficulty_levels_.begin(), difficulty_levels_.end()), difficulty_levels_.end());
+    unmastered_index_.assign(difficulty_levels_.size() + 1, 0);  // Slot 0 is unused
+    for (const Recipe& r : recipes) {
+        if (!r.mastered_) {
+            unmastered_index_[std::lower_bound(difficulty_levels_.begin(), difficulty_levels_.end(), r.difficulty_level_) - difficulty_levels_.begin() + 1]++;
+        }
+    }
+    for (size_t slot = 1; slot < unmastered_index_.size(); slot++) {
+        size_t parent = slot + (slot & (~slot + 1));
+        if (parent < unmastered_index_.size()) {
+            unmastered_index_[parent] += unmastered_index_[slot];
+        }
+    }
+}
+
+// Adds delta to the unmastered count of a difficulty level in the Fenwick tree
+void RecipeBook::updateUnmastered(int difficulty_level, int delta) {
+    auto level = std::lower_bound(difficulty_levels_.begin(), difficulty_levels_.end(), difficulty_level);
+    size_t slot = static_cast<size_t>(level - difficulty_levels_.begin()) + 1;
+    if (level == difficulty_levels_.end() || *level != difficulty_level) {
+        // A new level: turn the Fenwick tree back into per-level counts (children before parents,
+        // so walk down), open a zero slot at the level's sorted position, and rebuild it
+        if (unmastered_index_.empty()) {
+            unmastered_index_.assign(1, 0);  // Slot 0 is unused
+        }
+        for (size_t i = unmastered_index_.size() - 1; i > 0; i--) {
+            size_t parent = i + (i & (~i + 1));
+            if (parent < unmastered_index_.size()) {
+                unmastered_index_[parent] -= unmastered_index_[i];
+            }
+        }
+        difficulty_levels_.insert(level, difficulty_level);
+        unmastered_index_.insert(unmastered_index_.begin() + slot, 0);
+        for (size_t i = 1; i < unmastered_index_.size(); i++) {
+            size_t parent = i + (i & (~i + 1));
+            if (parent < unmastered_index_.size()) {
+                unmastered_index_[parent] += unmastered_index_[i];
+            }
+        }
+    }
+    for (; slot < unmastered_index_.size(); slot += slot & (~slot + 1)) {
+        unmastered_index_[slot] += delta;
+    }
+}
+
+// Number of unmastered recipes with a difficulty level strictly lower than difficulty_level
+int RecipeBook::countUnmasteredBelow(int difficulty_level) const {
+    // Slots 1 .. slot hold exactly the levels below difficulty_level
+    size_t slot = std::lower_bound(difficulty_levels_.begin(), difficulty_levels_.end(), difficulty_level) - difficulty_levels_.begin();
+    int count = 0;
+    for (; slot > 0; slot -= slot & (~slot + 1)) {
+        count += unmastered_index_[slot];
+    }
+    return count;
 }
 
 // preorderdisplay function
@@ -207,38 +426,11 @@ void RecipeBook::balanceHelper(const std::vector<Recipe>& recipes, int start, in
     * (Add an empty line between Recipes)
 */
 void RecipeBook::preorderDisplay() const {
-    // Perform preorder traversal and define the lambda to display each recipe
-    preorderTraversal([this](const Recipe& r) {
-        std::cout << "Name: " << r.name_ << "\n";
-        std::cout << "Difficulty Level: " << r.difficulty_level_ << "\n";
-        std::cout << "Description: " << r.description_ << "\n";
-        std::cout << "Mastered: " << (r.mastered_ ? "Yes" : "No") << "\n\n";
-    });
-}
-
-// Private traversal methods
-void RecipeBook::inorderTraversal(std::function<void(const Recipe&)> visit) const {
-    inorderHelper(getRoot(), visit); // Start the inorder traversal from the root
-}
-
-void RecipeBook::preorderTraversal(std::function<void(const Recipe&)> visit) const {
-    preorderHelper(getRoot(), visit); // Start the preorder traversal from the root
-}
-
-// Inorder traversal helper (works with std::shared_ptr)
-void RecipeBook::inorderHelper(std::shared_ptr<BinaryNode<Recipe>> node, std::function<void(const Recipe&)> visit) const {
-    // Base case: if the node is null, return
-    if (node == nullptr) return;
-    inorderHelper(node->getLeftChildPtr(), visit);  // Traverse left subtree
-    visit(node->getItem());  // Visit the current node
-    inorderHelper(node->getRightChildPtr(), visit);  // Traverse right subtree
-}
-
-// Preorder traversal helper (works with std::shared_ptr)
-void RecipeBook::preorderHelper(std::shared_ptr<BinaryNode<Recipe>> node, std::function<void(const Recipe&)> visit) const {
-    if (node != nullptr) {
-        visit(node->getItem());  // Visit the current node
-        preorderHelper(node->getLeftChildPtr(), visit);  // Traverse left subtree
-        preorderHelper(node->getRightChildPtr(), visit);  // Traverse right subtree
+    // Perform preorder traversal and display each recipe
+    for (preorder_iterator it = preorderBegin(); it != preorderEnd(); ++it) {
+        std::cout << "Name: " << it->name_ << "\n";
+        std::cout << "Difficulty Level: " << it->difficulty_level_ << "\n";
+        std::cout << "Description: " << it->description_ << "\n";
+        std::cout << "Mastered: " << (it->mastered_ ? "Yes" : "No") << "\n\n";
     }
 }
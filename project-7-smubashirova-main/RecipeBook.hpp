@@ -15,12 +15,11 @@
 #include "BinarySearchTree.hpp" 
 #include "BinaryNode.hpp"
 #include <string>
+#include <string_view> // for zero-copy CSV fields
 #include <fstream> // for file I/O
-#include <sstream> //for string stream
 #include <iostream>
 #include <vector> 
 #include <algorithm> //for sort
-#include <functional> //for lambda functions
 #include <memory>  // for shared_ptr
 
 struct Recipe {
@@ -68,8 +67,28 @@ struct Recipe {
     bool operator>(const Recipe& other) const;
 };
 
-class RecipeBook : public BinarySearchTree<Recipe> {
+// The tree is a private base: add, remove, buildBalanced, rebuildBalanced, setRoot and the nodes
+// reachable through getRoot would change the recipes without updating the difficulty index, so
+// only the read-only tree members are re-exported, and recipes change through RecipeBook's own functions.
+class RecipeBook : private BinarySearchTree<Recipe, AVLBalancing> {
 public:
+    using BinarySearchTree<Recipe, AVLBalancing>::iterator;
+    using BinarySearchTree<Recipe, AVLBalancing>::const_iterator;
+    using BinarySearchTree<Recipe, AVLBalancing>::preorder_iterator;
+    using BinarySearchTree<Recipe, AVLBalancing>::postorder_iterator;
+    using BinarySearchTree<Recipe, AVLBalancing>::isEmpty;
+    using BinarySearchTree<Recipe, AVLBalancing>::getHeight;
+    using BinarySearchTree<Recipe, AVLBalancing>::getNumberOfNodes;
+    using BinarySearchTree<Recipe, AVLBalancing>::contains;
+    using BinarySearchTree<Recipe, AVLBalancing>::rank;
+    using BinarySearchTree<Recipe, AVLBalancing>::countInRange;
+    using BinarySearchTree<Recipe, AVLBalancing>::begin;
+    using BinarySearchTree<Recipe, AVLBalancing>::end;
+    using BinarySearchTree<Recipe, AVLBalancing>::preorderBegin;
+    using BinarySearchTree<Recipe, AVLBalancing>::preorderEnd;
+    using BinarySearchTree<Recipe, AVLBalancing>::postorderBegin;
+    using BinarySearchTree<Recipe, AVLBalancing>::postorderEnd;
+
     /**
         * Default Constructor.
         * @post: Initializes an empty RecipeBook.
@@ -83,6 +102,9 @@ public:
         * The file format is as follows:
         * name,difficulty_level,description,mastered
         * Ignore the first line. Each subsequent line represents a Recipe to be added to the RecipeBook.
+        * Fields containing commas may be enclosed in double quotes ("" stands for a literal quote).
+        * @note: The file is memory-mapped and parsed in place; a pipe, FIFO or other unmappable file is read through its descriptor instead. Rows are bulk-loaded: sorted by name (skipped if already sorted), de-duplicated keeping the
+        * first row with each name (as addRecipe would), and built into a perfectly balanced tree in O(n log n).
     */
     RecipeBook(const std::string& filename);
 
@@ -91,8 +113,24 @@ public:
         * Finds a Recipe in the tree by name.
         * @param name A const reference to a string representing the name of the Recipe.
         * @return A pointer to the node containing the Recipe with the given difficulty level, or nullptr if not found.
+        * @note: The Recipe is read-only; use setMastered to change mastered_ so the difficulty index stays in sync.
+    */
+    const Recipe* findRecipe(const std::string &name) const;
+
+    /**
+        * Finds the k-th Recipe in name order.
+        * @param k A 0-based position in name order.
+        * @return A read-only pointer to the k-th Recipe, or nullptr if k is out of range.
+        * @note: This and find only return read-only Recipes, so mastered_ changes only through setMastered.
     */
-    Recipe* findRecipe(const std::string &name) const;
+    const Recipe* select(int k) const;
+
+    /**
+        * Finds the Recipe with the same name as entry.
+        * @param entry A const reference to a Recipe whose name_ is looked up.
+        * @return A read-only pointer to the stored Recipe, or nullptr if not found.
+    */
+    const Recipe* find(const Recipe &entry) const;
 
     // Add a Recipe Function
     /**
@@ -104,6 +142,13 @@ public:
     */
     bool addRecipe(const Recipe &recipe);
 
+    /**
+        * Adds a Recipe to the tree, moving it into the new node instead of copying it.
+        * @param recipe An rvalue reference to a Recipe object.
+        * @return: True if the Recipe was successfully added; false if a Recipe with the same name already exists.
+    */
+    bool addRecipe(Recipe &&recipe);
+
     // Remove a Recipe Function
     /**
         * Removes a Recipe from the tree by name.
@@ -130,6 +175,16 @@ public:
     */
     int calculateMasteryPoints(const std::string &name) const;
 
+    // Setmastered Function
+    /**
+        * Marks a Recipe as mastered or unmastered.
+        * @param name A const reference to a string representing the name of the Recipe.
+        * @param mastered The new mastery status.
+        * @post: The Recipe's mastered_ is updated, and so is the difficulty index used by calculateMasteryPoints.
+        * @return: True if the Recipe was found; false otherwise.
+    */
+    bool setMastered(const std::string &name, bool mastered);
+
     // Balance Function
     /**
         * Balances the tree.
@@ -151,11 +206,22 @@ public:
     void preorderDisplay() const;
 
 private:
-    void balanceHelper(const std::vector<Recipe>& recipes, int start, int end);  // Helper function to balance the tree.
-    void inorderTraversal(std::function<void(const Recipe&)> visit) const;  // Inorder traversal of the tree.
-    void preorderTraversal(std::function<void(const Recipe&)> visit) const;  // Preorder traversal of the tree.
-    void inorderHelper(std::shared_ptr<BinaryNode<Recipe>> node, std::function<void(const Recipe&)> visit) const;  // Helper function for inorder traversal.
-    void preorderHelper(std::shared_ptr<BinaryNode<Recipe>> node, std::function<void(const Recipe&)> visit) const;  // Helper function for preorder traversal.
+    // Fenwick (binary indexed) tree counting unmastered Recipes per difficulty level, so
+    // calculateMasteryPoints is O(log levels). Slot i (1-based) is difficulty_levels_[i - 1].
+    // Kept in sync by addRecipe, removeRecipe, clear and setMastered.
+    std::vector<int> unmastered_index_;
+    // Every distinct difficulty level seen so far, ascending. Any int level, negative or huge,
+    // gets one compact slot; a level not seen before costs one O(levels) rebuild of the index.
+    std::vector<int> difficulty_levels_;
+
+    Recipe* findMutableRecipe(const std::string &name);  // Same as findRecipe, for setMastered to update in place.
+    static void parseCsv(const char* data, size_t length, std::vector<Recipe>& recipes);  // Parses CSV text into Recipes.
+    static std::string_view readCsvField(const char* data, size_t length, size_t& pos, std::string& scratch);  // Reads one (possibly quoted) field.
+    static void skipCsvRecord(const char* data, size_t length, size_t& pos);  // Skips to the start of the next line.
+    void bulkLoad(std::vector<Recipe>&& recipes);  // Replaces the contents with recipes, built bottom-up.
+    void buildUnmasteredIndex(const std::vector<Recipe>& recipes);  // Rebuilds both difficulty indexes from scratch in O(n log n).
+    void updateUnmastered(int difficulty_level, int delta);  // Adds delta to the unmastered count of a difficulty level.
+    int countUnmasteredBelow(int difficulty_level) const;  // Number of unmastered Recipes with a lower difficulty level.
 };
 
 #endif // RECIPEBOOK_HPP
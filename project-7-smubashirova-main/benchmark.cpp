@@ -0,0 +1,380 @@
+//  Assignment: Project 7
+//  Description: This program times ArenaBinarySearchTree against the
+//  shared_ptr-backed BinarySearchTree on 1M shuffled int keys, and
+//  RecipeBook loading and name lookups at 10k/100k/1M recipes, and the
+//  tree iterators against recursive std::function traversal helpers, and
+//  the order-statistic queries against counting through an iterator, and
+//  rebuildBalanced against copying out and re-adding every item, and the
+//  RecipeBook CSV bulk load against adding the rows one at a time, and the
+//  memory-mapped CSV parser against the original getline/stringstream loader.
+
+#include "BinarySearchTree.hpp"
+#include "ArenaBinarySearchTree.hpp"
+#include "RecipeBook.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Milliseconds taken by one call of work
+template <class Work>
+double timeMs(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Prints one row of the comparison
+void report(const char* operation, double tree_ms, double arena_ms) {
+    std::cout << operation << ": shared_ptr " << tree_ms << " ms, arena " << arena_ms << " ms" << std::endl;
+}
+
+// Sums the shared_ptr tree in inorder the way its own helpers walk it
+long long sumInorder(const std::shared_ptr<BinaryNode<int>>& subtree) {
+    if (subtree == nullptr) {
+        return 0;
+    }
+    return sumInorder(subtree->getLeftChildPtr()) + subtree->getItem() + sumInorder(subtree->getRightChildPtr());
+}
+
+// Visits the subtree in inorder the way the original RecipeBook helpers did: recursion, a
+// shared_ptr and a std::function passed by value at every level
+void inorderHelper(std::shared_ptr<BinaryNode<int>> node, std::function<void(const int&)> visit) {
+    if (node == nullptr) return;
+    inorderHelper(node->getLeftChildPtr(), visit);
+    visit(node->getItem());
+    inorderHelper(node->getRightChildPtr(), visit);
+}
+
+// Same as inorderHelper, in preorder
+void preorderHelper(std::shared_ptr<BinaryNode<int>> node, std::function<void(const int&)> visit) {
+    if (node == nullptr) return;
+    visit(node->getItem());
+    preorderHelper(node->getLeftChildPtr(), visit);
+    preorderHelper(node->getRightChildPtr(), visit);
+}
+
+// Distinct recipe names "recipe0000000".. in shuffled order
+std::vector<std::string> shuffledNames(int n) {
+    std::vector<std::string> names(n);
+    char buffer[32];
+    for (int i = 0; i < n; i++) {
+        std::snprintf(buffer, sizeof(buffer), "recipe%07d", i);
+        names[i] = buffer;
+    }
+    std::shuffle(names.begin(), names.end(), std::mt19937(n));
+    return names;
+}
+
+// Writes names as a RecipeBook CSV file, one row per name
+void writeRecipeCsv(const std::string& filename, const std::vector<std::string>& names) {
+    std::ofstream file(filename);
+    file << "name,difficulty_level,description,mastered\n";
+    for (size_t i = 0; i < names.size(); i++) {
+        file << names[i] << ',' << (i % 10) + 1 << ",a recipe," << (i % 3 == 0 ? "true" : "false") << '\n';
+    }
+}
+
+// Finds a recipe the way the original findRecipe did: visit every recipe in inorder, keep the match
+const Recipe* findRecipeByScan(const RecipeBook& book, const std::string& name) {
+    const Recipe* found = nullptr;
+    for (const Recipe& r : book) {
+        if (r.name_ == name) {
+            found = &r;
+        }
+    }
+    return found;
+}
+
+// Loads filename into book the way the original RecipeBook(filename) did: getline, a
+// stringstream and operator>> per row, and one addRecipe per row
+void loadRowByRow(RecipeBook& book, const std::string& filename) {
+    std::ifstream file(filename);
+    std::string line;
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        std::string name, description, mastered_str;
+        int difficulty_level;
+        std::getline(ss, name, ',');
+        ss >> difficulty_level;
+        ss.ignore();
+        std::getline(ss, description, ',');
+        std::getline(ss, mastered_str);
+        book.addRecipe(Recipe(name, difficulty_level, description, mastered_str == "true"));
+    }
+}
+
+// Times ArenaBinarySearchTree against BinarySearchTree; returns false if they disagree
+bool benchmarkArena() {
+    const int n = 1000000;
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = i;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(1));
+
+    BinarySearchTree<int> tree;
+    ArenaBinarySearchTree<int> arena;
+    long long tree_sum = 0, arena_sum = 0;
+    int tree_found = 0, arena_found = 0;
+
+    std::cout << "1M shuffled ints, NoBalancing" << std::endl;
+    double tree_ms = timeMs([&] { for (int key : keys) tree.add(key); });
+    double arena_ms = timeMs([&] { for (int key : keys) arena.add(key); });
+    report("insert", tree_ms, arena_ms);
+
+    tree_ms = timeMs([&] { for (int key : keys) tree_found += tree.contains(key); });
+    arena_ms = timeMs([&] { for (int key : keys) arena_found += arena.contains(key); });
+    report("contains", tree_ms, arena_ms);
+
+    tree_ms = timeMs([&] { tree_sum = sumInorder(tree.getRoot()); });
+    arena_ms = timeMs([&] { arena.inorderTraverse([&](const int& key) { arena_sum += key; }); });
+    report("inorder sum", tree_ms, arena_ms);
+
+    tree_ms = timeMs([&] { for (int i = 0; i < n; i += 2) tree.remove(keys[i]); });
+    arena_ms = timeMs([&] { for (int i = 0; i < n; i += 2) arena.remove(keys[i]); });
+    report("remove half", tree_ms, arena_ms);
+
+    arena_ms = timeMs([&] { arena.clear(); });
+    std::cout << "clear: arena " << arena_ms << " ms" << std::endl;
+
+    return tree_found == n && arena_found == n && tree_sum == arena_sum;
+}
+
+// Times iterator walks against the recursive std::function helpers on 1M shuffled keys in an
+// AVL tree; returns false if the walks disagree
+bool benchmarkIterators() {
+    const int n = 1000000;
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = i;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(2));
+    BinarySearchTree<int, AVLBalancing> tree;
+    for (int key : keys) {
+        tree.add(key);
+    }
+
+    std::cout << "1M shuffled ints, AVLBalancing" << std::endl;
+    long long helper_in = 0, helper_pre = 0, iterator_in = 0, iterator_pre = 0, iterator_post = 0;
+    double helper_ms = timeMs([&] { inorderHelper(tree.getRoot(), [&](const int& key) { helper_in += key; }); });
+    double iterator_ms = timeMs([&] { for (int key : tree) iterator_in += key; });
+    std::cout << "inorder sum: std::function helper " << helper_ms << " ms, iterator " << iterator_ms << " ms" << std::endl;
+
+    helper_ms = timeMs([&] { preorderHelper(tree.getRoot(), [&](const int& key) { helper_pre += key; }); });
+    iterator_ms = timeMs([&] {
+        for (auto it = tree.preorderBegin(); it != tree.preorderEnd(); ++it) iterator_pre += *it;
+    });
+    std::cout << "preorder sum: std::function helper " << helper_ms << " ms, iterator " << iterator_ms << " ms" << std::endl;
+
+    iterator_ms = timeMs([&] {
+        for (auto it = tree.postorderBegin(); it != tree.postorderEnd(); ++it) iterator_post += *it;
+    });
+    std::cout << "postorder sum: iterator " << iterator_ms << " ms" << std::endl;
+
+    // The helpers cannot stop early; find_if stops at the match
+    bool found = false;
+    iterator_ms = timeMs([&] { found = std::find_if(tree.begin(), tree.end(), [](int key) { return key == 1000; }) != tree.end(); });
+    std::cout << "find_if key 1000: iterator " << iterator_ms << " ms" << std::endl;
+
+    return found && helper_in == iterator_in && helper_pre == iterator_pre && iterator_post == iterator_in;
+}
+
+// Times getNumberOfNodes, rank, select and countInRange on 1M keys against walking the tree
+// with an iterator; returns false if the answers disagree
+bool benchmarkOrderStatistics() {
+    const int n = 1000000, queries = 10;
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = i;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+    BinarySearchTree<int, AVLBalancing> tree;
+    for (int key : keys) {
+        tree.add(key);
+    }
+
+    std::cout << "1M shuffled ints, order statistics (" << queries << " queries)" << std::endl;
+    long long cached = 0, walked = 0;
+    double cached_ms = timeMs([&] { for (int i = 0; i < queries; i++) cached += tree.getNumberOfNodes(); });
+    double walk_ms = timeMs([&] { for (int i = 0; i < queries; i++) walked += std::distance(tree.begin(), tree.end()); });
+    std::cout << "getNumberOfNodes: cached " << cached_ms << " ms, iterator count " << walk_ms << " ms" << std::endl;
+    bool ok = cached == walked;
+
+    cached = walked = 0;
+    cached_ms = timeMs([&] { for (int i = 0; i < queries; i++) cached += tree.rank(keys[i]); });
+    walk_ms = timeMs([&] {
+        for (int i = 0; i < queries; i++) walked += std::distance(tree.begin(), std::find(tree.begin(), tree.end(), keys[i]));
+    });
+    std::cout << "rank: O(log n) " << cached_ms << " ms, iterator count " << walk_ms << " ms" << std::endl;
+    ok = ok && cached == walked;
+
+    // Page through items 500000..500049, as the catalog would page through recipes
+    cached = walked = 0;
+    cached_ms = timeMs([&] { for (int k = 500000; k < 500050; k++) cached += *tree.select(k); });
+    walk_ms = timeMs([&] {
+        auto it = std::next(tree.begin(), 500000);
+        for (int k = 0; k < 50; k++, ++it) walked += *it;
+    });
+    std::cout << "select page of 50: O(log n) each " << cached_ms << " ms, iterator advance " << walk_ms << " ms" << std::endl;
+    ok = ok && cached == walked;
+
+    cached = walked = 0;
+    cached_ms = timeMs([&] { for (int i = 0; i < queries; i++) cached += tree.countInRange(keys[i] / 2, keys[i]); });
+    walk_ms = timeMs([&] {
+        for (int i = 0; i < queries; i++) walked += std::count_if(tree.begin(), tree.end(), [&](int key) { return keys[i] / 2 <= key && key <= keys[i]; });
+    });
+    std::cout << "countInRange: O(log n) " << cached_ms << " ms, iterator count " << walk_ms << " ms" << std::endl;
+    return ok && cached == walked;
+}
+
+// Re-adds items[start..end] middle first, as the original balanceHelper did
+void addMiddleFirst(BinarySearchTree<int>& tree, const std::vector<int>& items, int start, int end) {
+    if (start > end) return;
+    int mid = start + (end - start) / 2;
+    tree.add(items[mid]);
+    addMiddleFirst(tree, items, start, mid - 1);
+    addMiddleFirst(tree, items, mid + 1, end);
+}
+
+// Times rebuildBalanced on 1M nodes against copying the items out, clearing the tree and
+// re-adding them middle first; returns false if the trees differ
+bool benchmarkBalance() {
+    const int n = 1000000;
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = i;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(4));
+    BinarySearchTree<int> relinked, readded;
+    for (int key : keys) {
+        relinked.add(key);
+        readded.add(key);
+    }
+
+    std::cout << "1M shuffled ints, balance (height " << relinked.getHeight() << ")" << std::endl;
+    double relink_ms = timeMs([&] { relinked.rebuildBalanced(); });
+    double readd_ms = timeMs([&] {
+        std::vector<int> items(readded.begin(), readded.end());
+        readded.setRoot(nullptr);
+        addMiddleFirst(readded, items, 0, n - 1);
+    });
+    std::cout << "rebuild: relink in place " << relink_ms << " ms, copy and re-add " << readd_ms << " ms" << std::endl;
+
+    std::vector<std::string> names = shuffledNames(n);
+    RecipeBook book;
+    for (int i = 0; i < n; i++) {
+        book.addRecipe(Recipe(names[i], (i % 10) + 1, "a recipe"));
+    }
+    double book_ms = timeMs([&] { book.balance(); });
+    std::cout << "RecipeBook::balance: " << book_ms << " ms (height " << book.getHeight() << ")" << std::endl;
+
+    return relinked.getHeight() == readded.getHeight() && std::equal(relinked.begin(), relinked.end(), readded.begin())
+        && book.getNumberOfNodes() == n;
+}
+
+// Times loading a RecipeBook and looking up every recipe by name at n recipes, against the
+// original full inorder scan on a sample of names; returns false if a lookup misses
+bool benchmarkRecipeLookup(int n) {
+    const int scan_sample = 10;
+    const std::string filename = "benchmark_recipes.csv";
+    std::vector<std::string> names = shuffledNames(n);
+    writeRecipeCsv(filename, names);
+
+    std::cout << n << " recipes" << std::endl;
+    RecipeBook added;
+    double add_ms = timeMs([&] {
+        for (int i = 0; i < n; i++) added.addRecipe(Recipe(names[i], (i % 10) + 1, "a recipe", i % 3 == 0));
+    });
+    std::cout << "load by addRecipe: " << add_ms << " ms" << std::endl;
+
+    double csv_ms = timeMs([&] { RecipeBook loaded(filename); });  // Includes freeing the tree
+    std::cout << "load from CSV: " << csv_ms << " ms" << std::endl;
+    std::remove(filename.c_str());
+
+    int found = 0;
+    double keyed_ms = timeMs([&] { for (const std::string& name : names) found += added.findRecipe(name) != nullptr; });
+    int scanned = 0;
+    double scan_ms = timeMs([&] {
+        for (int i = 0; i < scan_sample; i++) scanned += findRecipeByScan(added, names[i]) != nullptr;
+    });
+    std::cout << "findRecipe: keyed " << keyed_ms * 1000 / n << " us/lookup, full scan "
+              << scan_ms * 1000 / scan_sample << " us/lookup" << std::endl;
+
+    return found == n && scanned == scan_sample;
+}
+
+// Times RecipeBook(filename) on 1M-row files, shuffled and already sorted, against adding the rows
+// one at a time; returns false if the books differ
+bool benchmarkBulkLoad() {
+    const int n = 1000000;
+    const std::string shuffled_file = "benchmark_shuffled.csv", sorted_file = "benchmark_sorted.csv";
+    std::vector<std::string> names = shuffledNames(n);
+    writeRecipeCsv(shuffled_file, names);
+    std::sort(names.begin(), names.end());
+    writeRecipeCsv(sorted_file, names);
+
+    std::cout << "1M-row CSV, bulk load" << std::endl;
+    int shuffled_count = 0, sorted_count = 0, row_count = 0;
+    double shuffled_ms = timeMs([&] { RecipeBook book(shuffled_file); shuffled_count = book.getNumberOfNodes(); });
+    double sorted_ms = timeMs([&] { RecipeBook book(sorted_file); sorted_count = book.getNumberOfNodes(); });
+    double row_ms = timeMs([&] { RecipeBook book; loadRowByRow(book, shuffled_file); row_count = book.getNumberOfNodes(); });
+    std::cout << "load: bulk shuffled " << shuffled_ms << " ms, bulk sorted " << sorted_ms
+              << " ms, row by row " << row_ms << " ms" << std::endl;
+    std::remove(shuffled_file.c_str());
+    std::remove(sorted_file.c_str());
+    return shuffled_count == n && sorted_count == n && row_count == n;
+}
+
+// Times RecipeBook(filename) on a generated file of several hundred MB, with quoted descriptions
+// holding commas, against the original constructor; returns false if they load different names
+bool benchmarkCsvParser() {
+    const int n = 1000000;
+    const std::string filename = "benchmark_large.csv";
+    std::vector<std::string> names = shuffledNames(n);
+    std::string description = "\"";
+    while (description.size() < 300) {
+        description += "simmer, stir and season to taste; ";
+    }
+    description += "\"";
+    {
+        std::ofstream file(filename);
+        file << "name,difficulty_level,description,mastered\n";
+        for (int i = 0; i < n; i++) {
+            file << names[i] << ',' << (i % 10) + 1 << ',' << description << ',' << (i % 3 == 0 ? "true" : "false") << '\n';
+        }
+    }
+    std::ifstream size_probe(filename, std::ios::binary | std::ios::ate);
+    std::cout << "1M-row CSV of " << size_probe.tellg() / (1024 * 1024) << " MB, parser" << std::endl;
+
+    int mapped_count = 0, original_count = 0;
+    double mapped_ms = timeMs([&] { RecipeBook book(filename); mapped_count = book.getNumberOfNodes(); });
+    double original_ms = timeMs([&] { RecipeBook book; loadRowByRow(book, filename); original_count = book.getNumberOfNodes(); });
+    std::cout << "load: mmap and from_chars " << mapped_ms << " ms, getline and stringstream " << original_ms << " ms" << std::endl;
+    std::remove(filename.c_str());
+    return mapped_count == n && original_count == n;
+}
+
+int main() {
+    bool ok = benchmarkArena();
+    ok = benchmarkIterators() && ok;
+    ok = benchmarkOrderStatistics() && ok;
+    ok = benchmarkBalance() && ok;
+    ok = benchmarkBulkLoad() && ok;
+    ok = benchmarkCsvParser() && ok;
+    for (int n : {10000, 100000, 1000000}) {
+        ok = benchmarkRecipeLookup(n) && ok;
+    }
+    if (!ok) {
+        std::cout << "FAILURE: a benchmark checked the wrong answer" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,468 @@
+//  Assignment: Project 7
+//  Description: This program tests that AVLBalancing keeps BinarySearchTree
+//  logarithmically high when keys arrive in sorted order, and that
+//  ArenaBinarySearchTree handles a degenerate tree without recursion, that
+//  RecipeBook's mastery points hold for any difficulty level and its tree
+//  can only change through its own functions, and that the
+//  tree iterators visit every node in inorder, preorder and postorder, and
+//  that rank, select and countInRange agree with a linear count, and that
+//  rebuildBalanced keeps every item while making the tree perfectly balanced,
+//  that buildBalanced and the CSV bulk load build the same tree, and that the
+//  CSV parser handles quoting, line endings, signs and unmappable input.
+
+#include "BinarySearchTree.hpp"
+#include "ArenaBinarySearchTree.hpp"
+#include "RecipeBook.hpp"
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Collects the subtree at node in order recursively, as the expected result of an iterator walk
+void collectRecursive(const std::shared_ptr<BinaryNode<int>>& node, TraversalOrder order, std::vector<int>& items) {
+    if (node == nullptr) {
+        return;
+    }
+    if (order == TraversalOrder::Preorder) items.push_back(node->getItem());
+    collectRecursive(node->getLeftChildPtr(), order, items);
+    if (order == TraversalOrder::Inorder) items.push_back(node->getItem());
+    collectRecursive(node->getRightChildPtr(), order, items);
+    if (order == TraversalOrder::Postorder) items.push_back(node->getItem());
+}
+
+// Collects the items from first up to last
+template <class Iterator>
+std::vector<int> collect(Iterator first, Iterator last) {
+    std::vector<int> items;
+    for (; first != last; first++) {
+        items.push_back(*first);
+    }
+    return items;
+}
+
+// Checks that at every node the left and right subtree sizes differ by at most 1
+bool perfectlyBalanced(const std::shared_ptr<BinaryNode<int>>& node) {
+    if (node == nullptr) {
+        return true;
+    }
+    int left = node->getLeftChildPtr() ? node->getLeftChildPtr()->getSize() : 0;
+    int right = node->getRightChildPtr() ? node->getRightChildPtr()->getSize() : 0;
+    return std::abs(left - right) <= 1 && perfectlyBalanced(node->getLeftChildPtr()) && perfectlyBalanced(node->getRightChildPtr());
+}
+
+// Writes contents to filename as is, so tests control every byte of a CSV file
+void writeFile(const std::string& filename, const std::string& contents) {
+    std::ofstream file(filename, std::ios::binary);
+    file << contents;
+}
+
+// Checks all three iterator orders of tree against the recursive walk
+template <class BalancePolicy>
+void checkIterators(const BinarySearchTree<int, BalancePolicy>& tree) {
+    std::vector<int> inorder, preorder, postorder;
+    collectRecursive(tree.getRoot(), TraversalOrder::Inorder, inorder);
+    collectRecursive(tree.getRoot(), TraversalOrder::Preorder, preorder);
+    collectRecursive(tree.getRoot(), TraversalOrder::Postorder, postorder);
+    assert(collect(tree.begin(), tree.end()) == inorder);
+    assert(collect(tree.preorderBegin(), tree.preorderEnd()) == preorder);
+    assert(collect(tree.postorderBegin(), tree.postorderEnd()) == postorder);
+}
+
+// Whether Book lets callers change its tree without going through RecipeBook's functions
+template <class Book, class = void>
+struct CanAdd : std::false_type {};
+template <class Book>
+struct CanAdd<Book, decltype(void(std::declval<Book&>().add(Recipe())))> : std::true_type {};
+template <class Book, class = void>
+struct CanRemove : std::false_type {};
+template <class Book>
+struct CanRemove<Book, decltype(void(std::declval<Book&>().remove(Recipe())))> : std::true_type {};
+template <class Book, class = void>
+struct CanSetRoot : std::false_type {};
+template <class Book>
+struct CanSetRoot<Book, decltype(void(std::declval<Book&>().setRoot(nullptr)))> : std::true_type {};
+template <class Book, class = void>
+struct CanGetRoot : std::false_type {};
+template <class Book>
+struct CanGetRoot<Book, decltype(void(std::declval<Book&>().getRoot()))> : std::true_type {};
+template <class Book, class = void>
+struct CanBuildBalanced : std::false_type {};
+template <class Book>
+struct CanBuildBalanced<Book, decltype(void(std::declval<Book&>().buildBalanced(std::vector<Recipe>())))> : std::true_type {};
+template <class Book, class = void>
+struct CanRebuildBalanced : std::false_type {};
+template <class Book>
+struct CanRebuildBalanced<Book, decltype(void(std::declval<Book&>().rebuildBalanced()))> : std::true_type {};
+
+int main() {
+    const int n = 1000000;
+
+    // Test add: 1M ascending keys would make an unbalanced tree a 1M-deep list
+    BinarySearchTree<int, AVLBalancing> tree;
+    for (int key = 0; key < n; key++) {
+        tree.add(key);
+    }
+
+    // Test getNumberOfNodes: every key is in the tree
+    assert(tree.getNumberOfNodes() == n);
+    std::cout << "getNumberOfNodes: SUCCESS for " << n << " ascending keys" << std::endl;
+
+    // Test getHeight: the AVL bound is about 1.44 * log2(n)
+    int height = tree.getHeight();
+    assert(height <= 1.45 * std::log2(n) + 2);
+    std::cout << "getHeight: SUCCESS (" << height << ")" << std::endl;
+
+    // Test ArenaBinarySearchTree: sorted keys with NoBalancing make a list as deep as the tree is big
+    const int m = 20000;
+    ArenaBinarySearchTree<int> chain;
+    for (int key = 0; key < m; key++) {
+        chain.add(key);
+    }
+    assert(chain.getNumberOfNodes() == m && chain.getHeight() == m);
+    int expected = 0;
+    chain.inorderTraverse([&](const int& key) { assert(key == expected); expected++; });
+    assert(expected == m);
+    for (int key = m - 1; key >= 0; key--) {
+        assert(chain.remove(key));
+    }
+    assert(chain.isEmpty() && !chain.remove(0));
+    std::cout << "ArenaBinarySearchTree: SUCCESS for a " << m << "-deep chain" << std::endl;
+
+    // Test ArenaBinarySearchTree with AVLBalancing: same bound as the shared_ptr tree
+    ArenaBinarySearchTree<int, AVLBalancing> arena;
+    for (int key = 0; key < n; key++) {
+        arena.add(key);
+    }
+    assert(arena.getNumberOfNodes() == n);
+    assert(arena.getHeight() <= 1.45 * std::log2(n) + 2);
+    for (int key = 0; key < n; key += 2) {
+        assert(arena.remove(key));
+    }
+    assert(arena.getNumberOfNodes() == n / 2 && arena.contains(1) && !arena.contains(0));
+    std::cout << "ArenaBinarySearchTree<AVLBalancing>: SUCCESS (" << arena.getHeight() << ")" << std::endl;
+
+    // Test calculateMasteryPoints: negative and very large levels keep their order
+    RecipeBook book;
+    book.addRecipe(Recipe("Toast", -5, "", false));
+    book.addRecipe(Recipe("Tea", -3, "", false));
+    book.addRecipe(Recipe("Salad", 0, "", false));
+    book.addRecipe(Recipe("Souffle", INT_MAX, "", false));
+    book.addRecipe(Recipe("Broth", INT_MIN, "", true));
+    assert(book.calculateMasteryPoints("Toast") == 1);
+    assert(book.calculateMasteryPoints("Tea") == 2);
+    assert(book.calculateMasteryPoints("Salad") == 3);
+    assert(book.calculateMasteryPoints("Souffle") == 4);
+    assert(book.calculateMasteryPoints("Broth") == 0);
+    book.setMastered("Tea", true);
+    book.setMastered("Broth", false);
+    assert(book.calculateMasteryPoints("Toast") == 2);
+    assert(book.calculateMasteryPoints("Salad") == 3);
+    book.removeRecipe("Toast");
+    assert(book.calculateMasteryPoints("Salad") == 2);
+    std::cout << "calculateMasteryPoints: SUCCESS for negative and extreme levels" << std::endl;
+
+    // Test findRecipe, select and find: recipes are read-only, so mastered_ only changes through setMastered
+    static_assert(std::is_same<decltype(book.findRecipe("Tea")), const Recipe*>::value, "findRecipe must be read-only");
+    static_assert(std::is_same<decltype(book.select(0)), const Recipe*>::value, "select must be read-only");
+    static_assert(std::is_same<decltype(book.find(Recipe())), const Recipe*>::value, "find must be read-only");
+    assert(book.findRecipe("Tea")->mastered_ && book.select(0)->name_ == "Broth");
+    assert(book.find(Recipe("Salad", 0, "")) == book.findRecipe("Salad"));
+    std::cout << "findRecipe: SUCCESS (read-only)" << std::endl;
+
+    // Test RecipeBook: the tree's mutators and nodes are out of reach, so the difficulty index stays current
+    using RecipeTree = BinarySearchTree<Recipe, AVLBalancing>;
+    static_assert(CanAdd<RecipeTree>::value && CanRemove<RecipeTree>::value && CanSetRoot<RecipeTree>::value
+                  && CanGetRoot<RecipeTree>::value && CanBuildBalanced<RecipeTree>::value && CanRebuildBalanced<RecipeTree>::value,
+                  "the checks must see the tree's own members");
+    static_assert(!CanAdd<RecipeBook>::value && !CanRemove<RecipeBook>::value && !CanSetRoot<RecipeBook>::value,
+                  "RecipeBook must hide add, remove and setRoot");
+    static_assert(!CanGetRoot<RecipeBook>::value, "RecipeBook must hide getRoot, whose nodes hand out mutable Recipes");
+    static_assert(!CanBuildBalanced<RecipeBook>::value && !CanRebuildBalanced<RecipeBook>::value,
+                  "RecipeBook must hide buildBalanced and rebuildBalanced");
+    static_assert(!std::is_convertible<RecipeBook*, RecipeTree*>::value, "RecipeBook must not convert to its tree");
+    std::cout << "RecipeBook: SUCCESS (tree mutators hidden)" << std::endl;
+
+    // Test iterators: an empty tree starts past-the-end in every order
+    BinarySearchTree<int> empty;
+    assert(empty.begin() == empty.end());
+    assert(empty.preorderBegin() == empty.preorderEnd());
+    assert(empty.postorderBegin() == empty.postorderEnd());
+
+    // Test iterators: a root that is also a leaf is visited once in every order
+    BinarySearchTree<int> single;
+    single.add(5);
+    assert(collect(single.begin(), single.end()) == std::vector<int>({5}));
+    assert(collect(single.preorderBegin(), single.preorderEnd()) == std::vector<int>({5}));
+    assert(collect(single.postorderBegin(), single.postorderEnd()) == std::vector<int>({5}));
+
+    // Test iterators: a full three-level tree, climbing back to the root from each leaf
+    BinarySearchTree<int> full;
+    for (int key : {4, 2, 6, 1, 3, 5, 7}) {
+        full.add(key);
+    }
+    assert(collect(full.begin(), full.end()) == std::vector<int>({1, 2, 3, 4, 5, 6, 7}));
+    assert(collect(full.preorderBegin(), full.preorderEnd()) == std::vector<int>({4, 2, 1, 3, 6, 5, 7}));
+    assert(collect(full.postorderBegin(), full.postorderEnd()) == std::vector<int>({1, 3, 2, 5, 7, 6, 4}));
+
+    // Test iterators: a walk started at a subtree stops at that subtree's root instead of climbing past it
+    BinaryNode<int>* left = full.getRoot()->getLeftChildPtr().get();
+    assert(collect(BinarySearchTree<int>::iterator(left), BinarySearchTree<int>::iterator()) == std::vector<int>({1, 2, 3}));
+    assert(collect(BinarySearchTree<int>::preorder_iterator(left), BinarySearchTree<int>::preorder_iterator()) == std::vector<int>({2, 1, 3}));
+    assert(collect(BinarySearchTree<int>::postorder_iterator(left), BinarySearchTree<int>::postorder_iterator()) == std::vector<int>({1, 3, 2}));
+
+    // Test iterators: left and right chains, where every node but one is a single child
+    BinarySearchTree<int> left_chain, right_chain;
+    for (int key = 0; key < 5; key++) {
+        left_chain.add(4 - key);
+        right_chain.add(key);
+    }
+    checkIterators(left_chain);
+    checkIterators(right_chain);
+    assert(collect(left_chain.postorderBegin(), left_chain.postorderEnd()) == std::vector<int>({0, 1, 2, 3, 4}));
+    assert(collect(right_chain.preorderBegin(), right_chain.preorderEnd()) == std::vector<int>({0, 1, 2, 3, 4}));
+
+    // Test iterators: an AVL tree after rotations and removals, whose old roots' parent pointers are stale
+    BinarySearchTree<int, AVLBalancing> shuffled;
+    std::vector<int> keys(10000);
+    for (int key = 0; key < 10000; key++) {
+        keys[key] = key;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+    for (int key : keys) {
+        shuffled.add(key);
+    }
+    for (int i = 0; i < 10000; i += 3) {
+        shuffled.remove(keys[i]);
+    }
+    checkIterators(shuffled);
+    assert(std::is_sorted(shuffled.begin(), shuffled.end()));
+
+    // Test iterators: std::find_if stops at the first match
+    auto found = std::find_if(full.begin(), full.end(), [](int key) { return key > 4; });
+    assert(found != full.end() && *found == 5);
+    std::cout << "iterators: SUCCESS for inorder, preorder and postorder" << std::endl;
+
+    // Test rank, select and countInRange: an empty tree has no items to rank, select or count
+    assert(empty.rank(0) == 0 && empty.select(0) == nullptr && empty.countInRange(0, 100) == 0);
+
+    // Test rank and select: the even keys 0, 2, .., 1998 with every fourth one removed
+    BinarySearchTree<int, AVLBalancing> evens;
+    for (int key = 0; key < 2000; key += 2) {
+        evens.add(key);
+    }
+    for (int key = 0; key < 2000; key += 8) {
+        evens.remove(key);
+    }
+    std::vector<int> sorted = collect(evens.begin(), evens.end());
+    assert(evens.getNumberOfNodes() == static_cast<int>(sorted.size()));
+    for (int k = 0; k < static_cast<int>(sorted.size()); k++) {
+        assert(evens.select(k) != nullptr && *evens.select(k) == sorted[k]);
+        assert(evens.rank(sorted[k]) == k);
+    }
+    assert(evens.select(-1) == nullptr && evens.select(sorted.size()) == nullptr);
+    assert(evens.rank(-5) == 0 && evens.rank(5000) == static_cast<int>(sorted.size()));
+    for (int key = -3; key < 2003; key++) {
+        int below = std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin();
+        assert(evens.rank(key) == below);  // Keys not in the tree rank where they would go
+    }
+    std::cout << "rank and select: SUCCESS for " << sorted.size() << " keys" << std::endl;
+
+    // Test countInRange: inclusive bounds, bounds outside the tree, empty and reversed ranges
+    assert(evens.countInRange(-100, 5000) == static_cast<int>(sorted.size()));
+    assert(evens.countInRange(2, 2) == 1 && evens.countInRange(0, 0) == 0);
+    assert(evens.countInRange(3, 3) == 0 && evens.countInRange(9, 9) == 0);  // Between keys
+    assert(evens.countInRange(10, 4) == 0);  // lo > hi
+    assert(evens.countInRange(-10, -1) == 0 && evens.countInRange(2000, 3000) == 0);
+    std::mt19937 random(11);
+    for (int i = 0; i < 2000; i++) {
+        int lo = static_cast<int>(random() % 2100) - 50, hi = static_cast<int>(random() % 2100) - 50;
+        int expected_count = 0;
+        for (int key : sorted) {
+            expected_count += (lo <= key && key <= hi);
+        }
+        assert(evens.countInRange(lo, hi) == expected_count);
+    }
+    std::cout << "countInRange: SUCCESS" << std::endl;
+
+    // Test rebuildBalanced: an empty tree stays empty
+    empty.rebuildBalanced();
+    assert(empty.isEmpty() && empty.getHeight() == 0);
+
+    // Test rebuildBalanced: a 4095-deep chain becomes a full 12-level tree holding the same nodes
+    BinarySearchTree<int> chain_tree;
+    for (int key = 0; key < 4095; key++) {
+        chain_tree.add(key);
+    }
+    assert(chain_tree.getHeight() == 4095);
+    const int* middle_item = chain_tree.find(2047);
+    chain_tree.rebuildBalanced();
+    assert(chain_tree.getHeight() == 12 && chain_tree.getNumberOfNodes() == 4095);
+    assert(chain_tree.find(2047) == middle_item && chain_tree.getRoot()->getItem() == 2047);  // Relinked, not copied
+    assert(perfectlyBalanced(chain_tree.getRoot()));
+    checkIterators(chain_tree);
+    for (int k = 0; k < 4095; k++) {
+        assert(*chain_tree.select(k) == k && chain_tree.rank(k) == k);  // Cached sizes are rebuilt
+    }
+
+    // Test rebuildBalanced: the tree keeps working after adds and removes
+    chain_tree.add(5000);
+    assert(chain_tree.remove(0) && chain_tree.remove(2047) && !chain_tree.contains(2047));
+    assert(chain_tree.getNumberOfNodes() == 4094 && *chain_tree.select(4093) == 5000);
+    checkIterators(chain_tree);
+
+    // Test rebuildBalanced: a shuffled tree whose size is not a power of two
+    BinarySearchTree<int> shuffled_tree;
+    for (int key : keys) {
+        if (key < 1000) shuffled_tree.add(key);
+    }
+    shuffled_tree.rebuildBalanced();
+    assert(shuffled_tree.getHeight() == 10 && shuffled_tree.getNumberOfNodes() == 1000);
+    assert(perfectlyBalanced(shuffled_tree.getRoot()));
+    std::vector<int> first_thousand(1000);
+    for (int key = 0; key < 1000; key++) {
+        first_thousand[key] = key;
+    }
+    assert(collect(shuffled_tree.begin(), shuffled_tree.end()) == first_thousand);
+
+    // Test balance: RecipeBook keeps its recipes and mastery points
+    RecipeBook balanced_book;
+    for (int i = 0; i < 1000; i++) {
+        balanced_book.addRecipe(Recipe("recipe" + std::to_string(1000 + i), i % 7, "", i % 5 == 0));
+    }
+    int points_before = balanced_book.calculateMasteryPoints("recipe1500");
+    balanced_book.balance();
+    assert(balanced_book.getNumberOfNodes() == 1000 && balanced_book.getHeight() == 10);
+    assert(balanced_book.calculateMasteryPoints("recipe1500") == points_before);
+    for (int i = 0; i < 1000; i++) {
+        assert(balanced_book.findRecipe("recipe" + std::to_string(1000 + i)) != nullptr);
+    }
+    std::cout << "rebuildBalanced and balance: SUCCESS" << std::endl;
+
+    // Test buildBalanced: sorted items are moved into a perfectly balanced tree, replacing its contents
+    BinarySearchTree<std::string> loaded;
+    loaded.add("old");
+    std::vector<std::string> sorted_names;
+    for (int i = 0; i < 1000; i++) {
+        sorted_names.push_back("name" + std::to_string(1000 + i));
+    }
+    std::vector<std::string> to_load = sorted_names;
+    loaded.buildBalanced(std::move(to_load));
+    assert(to_load.empty() && !loaded.contains("old"));
+    assert(loaded.getNumberOfNodes() == 1000 && loaded.getHeight() == 10);
+    assert(std::equal(loaded.begin(), loaded.end(), sorted_names.begin(), sorted_names.end()));
+    for (int k = 0; k < 1000; k++) {
+        assert(*loaded.select(k) == sorted_names[k] && loaded.rank(sorted_names[k]) == k);
+    }
+    loaded.add("zzz");
+    assert(loaded.remove("name1500") && loaded.getNumberOfNodes() == 1000);
+    loaded.buildBalanced({});
+    assert(loaded.isEmpty());
+
+    // Test RecipeBook(filename): already sorted input such as debug.csv
+    RecipeBook debug_book("debug.csv");
+    assert(debug_book.getNumberOfNodes() == 5 && debug_book.getHeight() == 3);
+    assert(debug_book.findRecipe("name3")->difficulty_level_ == 3);
+
+    // Test RecipeBook(filename): unsorted rows with duplicate names keep the first row, as addRecipe would
+    writeFile("test_bulk.csv", "name,difficulty_level,description,mastered\n"
+                               "Pie,4,first pie,false\nBread,2,,true\nApple,1,,false\n"
+                               "Pie,9,second pie,true\nCake,3,,false\nApple,7,,true\n");
+    RecipeBook bulk_book("test_bulk.csv");
+    RecipeBook added_book;
+    for (const Recipe& r : {Recipe("Pie", 4, "first pie"), Recipe("Bread", 2, "", true), Recipe("Apple", 1, ""),
+                            Recipe("Pie", 9, "second pie", true), Recipe("Cake", 3, ""), Recipe("Apple", 7, "", true)}) {
+        added_book.addRecipe(r);
+    }
+    assert(bulk_book.getNumberOfNodes() == 4 && bulk_book.getHeight() == 3);
+    assert(bulk_book.findRecipe("Pie")->description_ == "first pie" && !bulk_book.findRecipe("Apple")->mastered_);
+    for (const Recipe& r : added_book) {
+        assert(bulk_book.calculateMasteryPoints(r.name_) == added_book.calculateMasteryPoints(r.name_));
+    }
+    assert(std::equal(bulk_book.begin(), bulk_book.end(), added_book.begin(), added_book.end()));
+    std::remove("test_bulk.csv");
+    std::cout << "buildBalanced and bulk load: SUCCESS" << std::endl;
+
+    // Test RecipeBook(filename): quoted fields may hold commas, "" escapes and line breaks
+    writeFile("test_quoted.csv", "name,difficulty_level,description,mastered\n"
+                                 "\"Mac, Cheese\",2,\"creamy, baked\",true\n"
+                                 "Quote,3,\"say \"\"hi\"\"\",false\n"
+                                 "Multi,4,\"line one\nline two\",true\n"
+                                 "Extra,5,plain,false,ignored,fields\n"
+                                 "\n"
+                                 "Last,6,no newline,true");
+    RecipeBook quoted_book("test_quoted.csv");
+    assert(quoted_book.getNumberOfNodes() == 5);
+    const Recipe* mac = quoted_book.findRecipe("Mac, Cheese");
+    assert(mac && mac->difficulty_level_ == 2 && mac->description_ == "creamy, baked" && mac->mastered_);
+    assert(quoted_book.findRecipe("Quote")->description_ == "say \"hi\"");
+    assert(quoted_book.findRecipe("Multi")->description_ == "line one\nline two" && quoted_book.findRecipe("Multi")->mastered_);
+    assert(quoted_book.findRecipe("Extra")->description_ == "plain" && !quoted_book.findRecipe("Extra")->mastered_);
+    assert(quoted_book.findRecipe("Last")->difficulty_level_ == 6 && quoted_book.findRecipe("Last")->mastered_);
+    std::remove("test_quoted.csv");
+
+    // Test RecipeBook(filename): CRLF and bare CR line endings leave no '\r' in the last field
+    writeFile("test_crlf.csv", "name,difficulty_level,description,mastered\r\nA,1,first,true\r\nB,2,second,true\rC,3,third,false\r\n");
+    RecipeBook crlf_book("test_crlf.csv");
+    assert(crlf_book.getNumberOfNodes() == 3);
+    assert(crlf_book.findRecipe("A")->mastered_ && crlf_book.findRecipe("B")->mastered_ && !crlf_book.findRecipe("C")->mastered_);
+    assert(crlf_book.findRecipe("C")->description_ == "third");
+    std::remove("test_crlf.csv");
+
+    // Test RecipeBook(filename): difficulty levels are read the way operator>> read them
+    writeFile("test_numbers.csv", "name,difficulty_level,description,mastered\n"
+                                  "Plus,+7,,false\nSpaces, \t 8,,false\nNegative,-3,,false\nTrailing,12abc,,false\n"
+                                  "Word,abc,,false\nSign,-,,false\nDouble,+-4,,false\nEmpty,,,false\n"
+                                  "Huge,99999999999,,false\nTiny,-99999999999,,false\n");
+    RecipeBook numbers_book("test_numbers.csv");
+    assert(numbers_book.getNumberOfNodes() == 10);
+    assert(numbers_book.findRecipe("Plus")->difficulty_level_ == 7);
+    assert(numbers_book.findRecipe("Spaces")->difficulty_level_ == 8);
+    assert(numbers_book.findRecipe("Negative")->difficulty_level_ == -3);
+    assert(numbers_book.findRecipe("Trailing")->difficulty_level_ == 12);
+    assert(numbers_book.findRecipe("Word")->difficulty_level_ == 0);
+    assert(numbers_book.findRecipe("Sign")->difficulty_level_ == 0);
+    assert(numbers_book.findRecipe("Double")->difficulty_level_ == 0);
+    assert(numbers_book.findRecipe("Empty")->difficulty_level_ == 0);
+    assert(numbers_book.findRecipe("Huge")->difficulty_level_ == INT_MAX);
+    assert(numbers_book.findRecipe("Tiny")->difficulty_level_ == INT_MIN);
+    assert(numbers_book.calculateMasteryPoints("Tiny") == 1 && numbers_book.calculateMasteryPoints("Huge") == 10);
+    std::remove("test_numbers.csv");
+
+    // Test RecipeBook(filename): a missing, an empty and a header-only file give an empty book
+    writeFile("test_empty.csv", "");
+    writeFile("test_header.csv", "name,difficulty_level,description,mastered\n");
+    assert(RecipeBook("test_missing.csv").isEmpty());
+    assert(RecipeBook("test_empty.csv").isEmpty() && RecipeBook("test_header.csv").isEmpty());
+    std::remove("test_empty.csv");
+    std::remove("test_header.csv");
+
+    // Test RecipeBook(filename): a FIFO cannot be memory-mapped, so it is read through its descriptor
+    const char* fifo = "test_fifo.csv";
+    std::remove(fifo);
+    assert(mkfifo(fifo, 0600) == 0);
+    pid_t writer = fork();
+    if (writer == 0) {
+        writeFile(fifo, "name,difficulty_level,description,mastered\nPiped,2,\"from, a pipe\",true\nStream,1,,false\n");
+        _exit(0);
+    }
+    RecipeBook fifo_book(fifo);
+    waitpid(writer, nullptr, 0);
+    std::remove(fifo);
+    assert(fifo_book.getNumberOfNodes() == 2);
+    assert(fifo_book.findRecipe("Piped")->description_ == "from, a pipe" && fifo_book.findRecipe("Piped")->mastered_);
+    assert(fifo_book.calculateMasteryPoints("Stream") == 1);
+    std::cout << "CSV parser: SUCCESS for quoting, line endings, numbers and a FIFO" << std::endl;
+
+    return 0;
+}
@@ -8,15 +8,31 @@ DO NOT MODIFY THIS FILE. YOU DO NOT HAVE TO SUBMIT THIS FILE
 #define ARRAY_BAG_
 #include <iostream>
 #include <vector>
+#include <utility> // std::move
+#include <cstddef> // std::size_t
 
 template <class ItemType>
 class ArrayBag
 {
 
    public:
+   // A hash function for the optional hashed index; items that are equal must hash alike
+   typedef std::size_t (*HashFunction)(const ItemType &item);
+   // An equality test to use instead of ==, e.g. to compare pointers by what they point to
+   typedef bool (*EqualFunction)(const ItemType &left, const ItemType &right);
+
    /** default constructor**/
    ArrayBag();
 
+   /** copy constructor**/
+   ArrayBag(const ArrayBag<ItemType> &other);
+
+   /** copy assignment operator**/
+   ArrayBag<ItemType>& operator=(const ArrayBag<ItemType> &other);
+
+   /** destructor, releases the heap array if the bag has outgrown inline_items_**/
+   ~ArrayBag();
+
    /**
        @return item_count_ : the current size of the bag
    **/
@@ -27,8 +43,20 @@ class ArrayBag
    **/
    bool isEmpty() const;
 
+   /**
+       @return the number of items the bag can hold before it has to grow
+   **/
+   int getCapacity() const;
+
+   /**
+       @param new_capacity the number of items the bag should be able to hold without growing
+       @post getCapacity() >= new_capacity; the items and their order are unchanged
+   **/
+   void reserve(int new_capacity);
+
    /**
        @return true if new_entry was successfully added to items_, false otherwise
+       @post if items_ was full it is grown to twice its capacity first
    **/
    bool add(const ItemType &new_entry);
 
@@ -38,7 +66,16 @@ class ArrayBag
    bool remove(const ItemType &an_entry);
 
    /**
-       @post item_count_ == 0
+       @param should_remove called once on each item, in order, and returns true for the items to remove
+       @post the items should_remove picked are removed in a single pass and the remaining items keep
+       their relative order; with a hashed index, it is rebuilt once afterwards
+       @return the number of items removed
+      **/
+   template<class Predicate>
+   int removeIf(Predicate should_remove);
+
+   /**
+       @post item_count_ == 0, the capacity is kept
       **/
    void clear();
 
@@ -52,9 +89,19 @@ class ArrayBag
    **/
    int getFrequencyOf(const ItemType &an_entry) const;
 
+   /**
+       @param hash the hash function to index items_ with, or nullptr to go back to linear search
+       @param equal the equality test consistent with hash, or nullptr to compare items with ==
+       @post add, remove and contains find items through a hash table from item to slot
+       in items_ (expected O(1)) instead of scanning items_, and every comparison uses equal
+   **/
+   void useHashedIndex(HashFunction hash, EqualFunction equal = nullptr);
+
    protected:
-   static const int DEFAULT_CAPACITY = 100; //max size of items_ at 100 by default for this project
-   ItemType items_[DEFAULT_CAPACITY];      // Array of bag items
+   static const int SMALL_CAPACITY = 4;    // Bags up to this size keep their items in inline_items_
+   ItemType inline_items_[SMALL_CAPACITY]; // Inline storage, so small bags do not allocate
+   ItemType* items_;                       // Array of bag items: inline_items_ or a heap array
+   int capacity_;                          // Current size of the array items_ points to
    int item_count_;                        // Current count of bag items
 
    /**
@@ -64,6 +111,63 @@ class ArrayBag
       **/
    int getIndexOf(const ItemType &target) const;
 
+   /**
+       @return true if left and right are the same item under the bag's equality test
+      **/
+   bool isSameItem(const ItemType &left, const ItemType &right) const;
+
+   private:
+   // One slot of the hashed index: the position of an item in items_ and its hash
+   struct IndexSlot
+   {
+      int item_index;   // -1 if the slot is empty
+      std::size_t hash;
+   };
+
+   static const int MIN_INDEX_SIZE = 8;
+
+   HashFunction hash_;                   // nullptr unless useHashedIndex was called
+   EqualFunction equal_;                 // nullptr to compare items with ==
+   std::vector<IndexSlot> index_table_;  // Open addressing with linear probing, at most half full, size a power of 2
+
+   /**
+       @param new_capacity the new size of items_, at least item_count_
+       @post items_ is a heap array of new_capacity slots holding the same items in the same order
+      **/
+   void resize(int new_capacity);
+
+   /**
+       @param target to be found in items_
+       @param hash hash_(target)
+       @return the slot of index_table_ that refers to target, or -1 if items_ does not contain target
+      **/
+   int findIndexSlot(const ItemType &target, std::size_t hash) const;
+
+   /**
+       @param item_index a position in items_
+       @return the slot of index_table_ that refers to item_index
+      **/
+   int findIndexSlot(int item_index) const;
+
+   /**
+       @param item_index a position in items_ not yet in the index
+       @param hash hash_(items_[item_index])
+       @post index_table_ refers to item_index
+      **/
+   void insertIndex(int item_index, std::size_t hash);
+
+   /**
+       @param slot a non-empty slot of index_table_
+       @post the slot is emptied and the entries after it are shifted back so every entry stays reachable
+      **/
+   void eraseIndexSlot(int slot);
+
+   /**
+       @param table_size the new size of index_table_, a power of 2
+       @post index_table_ refers to every item in items_
+      **/
+   void rebuildIndex(std::size_t table_size);
+
 }; // end ArrayBag
 
 #include "ArrayBag.cpp"
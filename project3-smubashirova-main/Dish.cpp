@@ -13,6 +13,7 @@
 #include <iostream>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
+#include <functional> // For std::hash
 
 // Default Constructor
 Dish::Dish() 
@@ -123,3 +124,15 @@ bool Dish::operator==(const Dish& right)const{
 bool Dish::operator!=(const Dish& right)const{
     return !(*this == right);
 }
+
+/**
+    @param : A const reference to a dish.
+    @return : A hash of the fields `==` compares (name, cuisine type, preparation time, and price), so equal dishes hash alike.
+*/
+std::size_t Dish::hashOf(const Dish& dish){
+    std::size_t hash = std::hash<std::string>()(dish.name_);
+    hash = hash * 31 + static_cast<std::size_t>(dish.cuisine_type_);
+    hash = hash * 31 + std::hash<int>()(dish.prep_time_);
+    hash = hash * 31 + std::hash<double>()(dish.price_);
+    return hash;
+}
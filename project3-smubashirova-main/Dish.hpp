@@ -15,6 +15,7 @@
 
 #include <string>
 #include <vector>
+#include <cstddef> // For std::size_t
 
 class Dish {
 public:
@@ -135,6 +136,12 @@ public:
     */
     bool operator!=(const Dish & right)const;
 
+    /**
+        @param : A const reference to a dish.
+        @return : A hash of the fields `==` compares (name, cuisine type, preparation time, and price), so equal dishes hash alike.
+    */
+    static std::size_t hashOf(const Dish& dish);
+
 private:
     std::string name_;
     std::vector<std::string> ingredients_;
@@ -17,7 +17,9 @@
         * Default constructor.
         * Default-initializes all private members.
     */
-    Kitchen::Kitchen() : totalprep_time(0), countelaborate(0) {}
+    Kitchen::Kitchen() : totalprep_time(0), countelaborate(0) {
+        useHashedIndex(&Dish::hashOf); // newOrder and serveDish look dishes up by hash
+    }
 
     /**
         * Parameterized constructor.
@@ -27,6 +29,7 @@
     */
     Kitchen::Kitchen(int totalprep_times, int countelaborates, const std::vector<Dish>& dishes)
        : totalprep_time(totalprep_times), countelaborate(countelaborates) {
+       useHashedIndex(&Dish::hashOf); // newOrder and serveDish look dishes up by hash
        for (const auto& dish : dishes) {
               newOrder(dish); 
         }
@@ -114,20 +117,39 @@
         return count;
     }
 
+    /**
+        * @param should_release A predicate on `const Dish&` that picks the dishes to release.
+        * @post Removes the picked dishes in one stable pass and updates the totals once.
+        * @return The number of dishes released.
+    */
+    template<class Predicate>
+    int Kitchen::releaseDishesIf(Predicate should_release) {
+        int releasedPrepTime = 0;
+        int releasedElaborate = 0;
+        int released = removeIf([&](const Dish& dish) {
+            if (!should_release(dish)) {
+                return false;
+            }
+            releasedPrepTime += dish.getPrepTime();
+            if (isElaborate(dish)) {
+                releasedElaborate++;
+            }
+            return true;
+        });
+        totalprep_time -= releasedPrepTime;
+        countelaborate -= releasedElaborate;
+        return released;
+    }
+
     /**
         * @param : A reference to an integer representing the preparation time threshold of the dishes to be removed from the kitchen, with a default value of 0.
         * @post : Removes all dishes from the kitchen whose preparation time is less than the given time. If no time is given, removes all dishes from the kitchen. Ignore negative input.
         * @return : The number of dishes removed from the kitchen.
     */
     int Kitchen::releaseDishesBelowPrepTime(int prep_time_threshold) {
-    int removedCount = 0;
-    for (int i = getCurrentSize() - 1; i >= 0; i--) { // Iterate backward to avoid skipping elements
-        if (items_[i].getPrepTime() < prep_time_threshold) {
-            serveDish(items_[i]); // Remove the dish
-            removedCount++;
-        }
-    }
-    return removedCount;}
+    return releaseDishesIf([prep_time_threshold](const Dish& dish) {
+        return dish.getPrepTime() < prep_time_threshold;
+    });}
 
     /**
         * @param : A reference to a string representing a cuisine type with a value in ["ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"], or a default value of "ALL" if no cuisine type is given.
@@ -135,14 +157,10 @@
         * @return : The number of dishes removed from the kitchen.
     */
     int Kitchen::releaseDishesOfCuisineType(const std::string& cuisine_type) {
-    int removedCount = 0;
-    for (int i = getCurrentSize() - 1; i >= 0; i--) { // Iterate backward to avoid skipping elements
-        if (cuisine_type == "ALL" || items_[i].getCuisineType() == cuisine_type) {
-            serveDish(items_[i]); // Remove the dish
-            removedCount++;
-        }
-    }
-    return removedCount;}
+    bool all = (cuisine_type == "ALL");
+    return releaseDishesIf([all, &cuisine_type](const Dish& dish) {
+        return all || dish.getCuisineType() == cuisine_type;
+    });}
 
     /**
         * @post : Outputs a report of the dishes currently in the kitchen in the form: "ITALIAN: {x}\nMEXICAN: {x}\nCHINESE: {x}\nINDIAN:{x}\nAMERICAN: {x}\nFRENCH: {x}\nOTHER: {x}\n\n AVERAGE PREP TIME: {x}\ELABORATE: {x}%\n"
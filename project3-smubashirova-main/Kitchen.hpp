@@ -80,6 +80,7 @@ public:
     /**
         * @param : A reference to an integer representing the preparation time threshold of the dishes to be removed from the kitchen, with a default value of 0.
         * @post : Removes all dishes from the kitchen whose preparation time is less than the given time. If no time is given, removes all dishes from the kitchen. Ignore negative input.
+        * The remaining dishes keep their order. Takes a single pass over the kitchen.
         * @return : The number of dishes removed from the kitchen.
     */
     int releaseDishesBelowPrepTime(int prep_time = 0);
@@ -87,6 +88,7 @@ public:
     /**
         * @param : A reference to a string representing a cuisine type with a value in ["ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"], or a default value of "ALL" if no cuisine type is given.
         * @post : Removes all dishes from the kitchen whose cuisine type matches the given type. If no cuisine type is given, removes all dishes from the kitchen.
+        * The remaining dishes keep their order. Takes a single pass over the kitchen.
         * @return : The number of dishes removed from the kitchen.
     */
    int releaseDishesOfCuisineType(const std::string& cuisine_type = "ALL");
@@ -103,6 +105,9 @@ private:
     int countelaborate;
     // Helper function to determine if a dish is elaborate
     bool isElaborate(const Dish& dish) const;
+    // Helper function to remove the dishes should_release picks in one stable pass, updating the totals once
+    template<class Predicate>
+    int releaseDishesIf(Predicate should_release);
 };
 
 #endif // KITCHEN_HPP
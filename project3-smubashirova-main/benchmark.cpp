@@ -0,0 +1,136 @@
+//  Assignment: Project 3
+//  Description: This program times the growable ArrayBag at 1k, 100k and
+//  1M items, growing geometrically and after reserve, and Kitchen::newOrder
+//  at the same sizes, which the fixed 100-item bag could not hold, and the
+//  single-pass release functions on a kitchen of 100k dishes.
+
+#include "Kitchen.hpp"
+#include "Dish.hpp"
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Milliseconds taken by one call of work
+template <class Work>
+double timeMs(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The hashed index, so add does not scan the bag for duplicates and the timings show the growth
+std::size_t hashInt(const int& item) {
+    return static_cast<std::size_t>(item);
+}
+
+// A dish name for number n; dish names may only hold letters and spaces, so n is spelled in base 26
+std::string dishName(int n) {
+    std::string letters;
+    do {
+        letters.insert(letters.begin(), static_cast<char>('a' + n % 26));
+        n /= 26;
+    } while (n > 0);
+    return "Dish " + letters;
+}
+
+// Adds n ints growing from the inline buffer, then after reserve(n); true if every item is found
+bool benchmarkGrowth(int n) {
+    ArrayBag<int> grown;
+    grown.useHashedIndex(&hashInt);
+    int grown_capacity = grown.getCapacity();
+    int resizes = 0;
+    double grown_ms = timeMs([&] {
+        for (int i = 0; i < n; i++) {
+            grown.add(i);
+            if (grown.getCapacity() != grown_capacity) {
+                grown_capacity = grown.getCapacity();
+                resizes++;
+            }
+        }
+    });
+
+    ArrayBag<int> reserved;
+    reserved.useHashedIndex(&hashInt);
+    double reserved_ms = timeMs([&] {
+        reserved.reserve(n);
+        for (int i = 0; i < n; i++) {
+            reserved.add(i);
+        }
+    });
+    std::cout << n << " ints: add " << grown_ms << " ms (" << resizes << " resizes to capacity " << grown_capacity
+              << "), reserve then add " << reserved_ms << " ms" << std::endl;
+    return grown.getCurrentSize() == n && reserved.getCurrentSize() == n && grown.contains(0) && grown.contains(n - 1)
+           && reserved.contains(n / 2) && !grown.add(n - 1);
+}
+
+// Orders n distinct dishes; true if the kitchen holds all of them with the right prep-time sum
+bool benchmarkNewOrder(int n) {
+    Kitchen kitchen;
+    int added = 0;
+    double ms = timeMs([&] {
+        for (int i = 0; i < n; i++) {
+            if (kitchen.newOrder(Dish(dishName(i), {"Rice"}, 10, 5.00, Dish::CuisineType::OTHER))) {
+                added++;
+            }
+        }
+    });
+    std::cout << n << " dishes: newOrder " << ms << " ms" << std::endl;
+    return added == n && kitchen.getCurrentSize() == n && kitchen.getPrepTimeSum() == 10 * n;
+}
+
+// Releases dishes from a kitchen of 100k random dishes with release; true if the totals match
+// those worked out from scratch for the dishes should_release keeps
+template <class Release, class Predicate>
+bool benchmarkRelease(const char* label, Release release, Predicate should_release) {
+    const int n = 100000;
+    std::mt19937 rng(235);
+    std::vector<Dish> dishes;
+    for (int i = 0; i < n; i++) {
+        std::vector<std::string> ingredients(1 + rng() % 8, "Rice");
+        int prep_time = static_cast<int>(rng() % 120);
+        Dish::CuisineType cuisine_type = static_cast<Dish::CuisineType>(rng() % (Dish::CuisineType::OTHER + 1));
+        dishes.push_back(Dish(dishName(i), ingredients, prep_time, 5.00, cuisine_type));
+    }
+    Kitchen kitchen;
+    for (const Dish& dish : dishes) {
+        kitchen.newOrder(dish);
+    }
+
+    int released = 0;
+    double ms = timeMs([&] { released = release(kitchen); });
+    std::cout << n << " dishes, " << label << ": single pass " << ms << " ms (" << released << " released)" << std::endl;
+    int kept = 0, prep_time_sum = 0, elaborate = 0;
+    for (const Dish& dish : dishes) {
+        if (!should_release(dish)) {
+            kept++;
+            prep_time_sum += dish.getPrepTime();
+            elaborate += (dish.getIngredients().size() >= 5 && dish.getPrepTime() >= 60) ? 1 : 0;
+        }
+    }
+    return released == n - kept && kitchen.getCurrentSize() == kept && kitchen.getPrepTimeSum() == prep_time_sum
+           && kitchen.elaborateDishCount() == elaborate;
+}
+
+int main() {
+    std::cout << "sizeof(ArrayBag<int>) " << sizeof(ArrayBag<int>) << " bytes, sizeof(Kitchen) " << sizeof(Kitchen)
+              << " bytes (the fixed bag held 100 items inline: " << 100 * sizeof(Dish) << " bytes of dishes)" << std::endl;
+    bool ok = true;
+    for (int n : {1000, 100000, 1000000}) {
+        ok = benchmarkGrowth(n) && ok;
+        ok = benchmarkNewOrder(n) && ok;
+    }
+    ok = benchmarkRelease("releaseDishesBelowPrepTime(50)",
+                          [](Kitchen& kitchen) { return kitchen.releaseDishesBelowPrepTime(50); },
+                          [](const Dish& dish) { return dish.getPrepTime() < 50; }) && ok;
+    ok = benchmarkRelease("releaseDishesOfCuisineType(\"FRENCH\")",
+                          [](Kitchen& kitchen) { return kitchen.releaseDishesOfCuisineType("FRENCH"); },
+                          [](const Dish& dish) { return dish.getCuisineType() == "FRENCH"; }) && ok;
+    if (!ok) {
+        std::cout << "FAILURE: a benchmark checked the wrong answer" << std::endl;
+        return 1;
+    }
+    return 0;
+}
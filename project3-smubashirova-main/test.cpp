@@ -90,6 +90,46 @@ int main() {
     // Test kitchenReport: Generate a report of remaining dishes in the kitchen
     kitchen.kitchenReport();
 
+    // Test newOrder: The kitchen grows past 100 dishes
+    Kitchen bigKitchen;
+    int addedDishes = 0;
+    for (int i = 0; i < 250; i++) {
+        std::string name = "Dish ";
+        name += static_cast<char>('A' + i / 26 % 26);
+        name += static_cast<char>('a' + i % 26);
+        if (bigKitchen.newOrder(Dish(name, {"Rice"}, 10, 5.00, Dish::CuisineType::OTHER))) {
+            addedDishes++;
+        }
+    }
+    if (addedDishes == 250 && bigKitchen.getCurrentSize() == 250 && bigKitchen.getPrepTimeSum() == 2500) {
+        std::cout << "newOrder: SUCCESS for 250 dishes" << std::endl;
+    } else {
+        std::cout << "newOrder: FAILURE for 250 dishes (" << addedDishes << " added)" << std::endl;
+    }
+
+    // Test newOrder and serveDish: Duplicates are found among many dishes
+    Dish dishAb("Dish Ab", {"Rice"}, 10, 5.00, Dish::CuisineType::OTHER);
+    if (!bigKitchen.newOrder(dishAb) && bigKitchen.serveDish(dishAb) && !bigKitchen.contains(dishAb) && bigKitchen.newOrder(dishAb)) {
+        std::cout << "newOrder/serveDish: SUCCESS for duplicate Dish Ab" << std::endl;
+    } else {
+        std::cout << "newOrder/serveDish: FAILURE for duplicate Dish Ab" << std::endl;
+    }
+
+    // Test releaseDishesBelowPrepTime and releaseDishesOfCuisineType: Bulk removal keeps the totals right
+    for (int i = 0; i < 50; i++) {
+        std::string name = "Quick ";
+        name += static_cast<char>('a' + i % 26);
+        name += static_cast<char>('a' + i / 26);
+        bigKitchen.newOrder(Dish(name, {"Rice"}, 5, 3.00, Dish::CuisineType::ITALIAN));
+    }
+    int releasedQuick = bigKitchen.releaseDishesBelowPrepTime(10);
+    int releasedOther = bigKitchen.releaseDishesOfCuisineType("OTHER");
+    if (releasedQuick == 50 && releasedOther == 250 && bigKitchen.isEmpty() && bigKitchen.getPrepTimeSum() == 0) {
+        std::cout << "release: SUCCESS for 300 dishes" << std::endl;
+    } else {
+        std::cout << "release: FAILURE for 300 dishes (" << releasedQuick << ", " << releasedOther << " released)" << std::endl;
+    }
+
     return 0;
 }
 
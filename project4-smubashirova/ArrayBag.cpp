@@ -15,10 +15,48 @@ DO NOT MODIFY THIS FILE. YOU DO NOT HAVE TO SUBMIT THIS FILE
 
 /** default constructor**/
 template<class ItemType>
-ArrayBag<ItemType>::ArrayBag(): item_count_(0)
+ArrayBag<ItemType>::ArrayBag(): items_(inline_items_), capacity_(SMALL_CAPACITY), item_count_(0), hash_(nullptr), equal_(nullptr)
 {
 }  // end default constructor
 
+/** copy constructor**/
+template<class ItemType>
+ArrayBag<ItemType>::ArrayBag(const ArrayBag<ItemType>& other)
+   : items_(inline_items_), capacity_(SMALL_CAPACITY), item_count_(0), hash_(nullptr), equal_(nullptr)
+{
+   *this = other;
+}  // end copy constructor
+
+/** copy assignment operator**/
+template<class ItemType>
+ArrayBag<ItemType>& ArrayBag<ItemType>::operator=(const ArrayBag<ItemType>& other)
+{
+   if (this != &other)
+   {
+      item_count_ = 0;
+      reserve(other.item_count_);
+      for (int i = 0; i < other.item_count_; i++)
+      {
+         items_[i] = other.items_[i];
+      }  // end for
+      item_count_ = other.item_count_;
+      hash_ = other.hash_;
+      equal_ = other.equal_;
+      index_table_ = other.index_table_; // items_ has the same layout, so the index carries over
+   }  // end if
+   return *this;
+}  // end operator=
+
+/** destructor, releases the heap array if the bag has outgrown inline_items_**/
+template<class ItemType>
+ArrayBag<ItemType>::~ArrayBag()
+{
+   if (items_ != inline_items_)
+   {
+      delete[] items_;
+   }  // end if
+}  // end destructor
+
 /**
  @return item_count_ : the current size of the bag
  **/
@@ -37,24 +75,55 @@ bool ArrayBag<ItemType>::isEmpty() const
 	return item_count_ == 0;
 }  // end isEmpty
 
+/**
+ @return the number of items the bag can hold before it has to grow
+ **/
+template<class ItemType>
+int ArrayBag<ItemType>::getCapacity() const
+{
+	return capacity_;
+}  // end getCapacity
+
+/**
+ @param new_capacity the number of items the bag should be able to hold without growing
+ @post getCapacity() >= new_capacity; the items and their order are unchanged
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::reserve(int new_capacity)
+{
+	if (new_capacity > capacity_)
+	{
+		resize(new_capacity);
+	}  // end if
+}  // end reserve
+
 /**
  @return true if new_entry was successfully added to items_, false otherwise
+ @post if items_ was full it is grown to twice its capacity first
  **/
 template<class ItemType>
 bool ArrayBag<ItemType>::add(const ItemType& new_entry)
 {
-   if (contains(new_entry)) {
+   std::size_t hash = 0;
+   if (hash_ != nullptr) {
+       hash = hash_(new_entry);
+       if (findIndexSlot(new_entry, hash) > -1) {
+           return false;
+       }
+   } else if (contains(new_entry)) {
        return false;
    }
-	bool has_room = (item_count_ < DEFAULT_CAPACITY);
-	if (has_room)
+	if (item_count_ == capacity_)
 	{
-		items_[item_count_] = new_entry;
-		item_count_++;
-        return true;
+		resize(2 * capacity_);
 	}  // end if
-
-	return false;
+	items_[item_count_] = new_entry;
+	if (hash_ != nullptr)
+	{
+		insertIndex(item_count_, hash);
+	}  // end if
+	item_count_++;
+	return true;
 }  // end add
 
 /**
@@ -67,20 +136,90 @@ bool ArrayBag<ItemType>::remove(const ItemType& an_entry)
 	bool can_remove = !isEmpty() && (found_index > -1);
 	if (can_remove)
 	{
+		if (hash_ != nullptr)
+		{
+			eraseIndexSlot(findIndexSlot(found_index));
+		}  // end if
 		item_count_--;
-		items_[found_index] = items_[item_count_];
+		if (found_index != item_count_)
+		{
+			items_[found_index] = items_[item_count_];
+			if (hash_ != nullptr)
+			{
+				index_table_[findIndexSlot(item_count_)].item_index = found_index; // the last item moved
+			}  // end if
+		}  // end if
 	}  // end if
 
 	return can_remove;
 }  // end remove
 
 /**
- @post item_count_ == 0
+ @param should_remove called once on each item, in order, and returns true for the items to remove
+ @post the items should_remove picked are removed in a single pass and the remaining items keep
+ their relative order; with a hashed index, it is rebuilt once afterwards
+ @return the number of items removed
+ **/
+template<class ItemType>
+template<class Predicate>
+int ArrayBag<ItemType>::removeIf(Predicate should_remove)
+{
+   std::vector<int> new_index; // with a hashed index: new position of each item, -1 if removed
+   if (hash_ != nullptr)
+   {
+      new_index.resize(item_count_);
+   }  // end if
+   int kept_count = 0;
+   for (int i = 0; i < item_count_; i++)
+   {
+      const ItemType& item = items_[i];
+      if (should_remove(item))
+      {
+         if (hash_ != nullptr)
+         {
+            new_index[i] = -1;
+         }  // end if
+         continue;
+      }  // end if
+      if (kept_count != i)
+      {
+         items_[kept_count] = std::move(items_[i]);
+      }  // end if
+      if (hash_ != nullptr)
+      {
+         new_index[i] = kept_count;
+      }  // end if
+      kept_count++;
+   }  // end for
+
+   int removed_count = item_count_ - kept_count;
+   item_count_ = kept_count;
+   if (hash_ != nullptr && removed_count > 0)
+   {
+      // Point every entry at its item's new position, then reinsert from the cached hashes
+      for (IndexSlot& slot : index_table_)
+      {
+         if (slot.item_index > -1)
+         {
+            slot.item_index = new_index[slot.item_index];
+         }  // end if
+      }  // end for
+      rebuildIndex(index_table_.size());
+   }  // end if
+   return removed_count;
+}  // end removeIf
+
+/**
+ @post item_count_ == 0, the capacity is kept
  **/
 template<class ItemType>
 void ArrayBag<ItemType>::clear()
 {
 	item_count_ = 0;
+	for (IndexSlot& slot : index_table_)
+	{
+		slot.item_index = -1;
+	}  // end for
 }  // end clear
 
 /**
@@ -93,7 +232,7 @@ int ArrayBag<ItemType>::getFrequencyOf(const ItemType& an_entry) const
    int curr_index = 0;       // Current array index
    while (curr_index < item_count_)
    {
-      if (items_[curr_index] == an_entry)
+      if (isSameItem(items_[curr_index], an_entry))
       {
          frequency++;
       }  // end if
@@ -104,6 +243,31 @@ int ArrayBag<ItemType>::getFrequencyOf(const ItemType& an_entry) const
    return frequency;
 }  // end getFrequencyOf
 
+/**
+ @param hash the hash function to index items_ with, or nullptr to go back to linear search
+ @param equal the equality test consistent with hash, or nullptr to compare items with ==
+ @post add, remove and contains find items through a hash table from item to slot
+ in items_ (expected O(1)) instead of scanning items_, and every comparison uses equal
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::useHashedIndex(HashFunction hash, EqualFunction equal)
+{
+   hash_ = hash;
+   index_table_.clear(); // cached hashes belong to the previous function
+   if (hash_ == nullptr)
+   {
+      equal_ = nullptr;
+      return;
+   }  // end if
+   equal_ = equal;
+   std::size_t table_size = MIN_INDEX_SIZE;
+   while (table_size < 2 * static_cast<std::size_t>(item_count_))
+   {
+      table_size *= 2;
+   }  // end while
+   rebuildIndex(table_size);
+}  // end useHashedIndex
+
 /**
  @return true if an_entry is found in items_, false otherwise
  **/
@@ -123,6 +287,12 @@ bool ArrayBag<ItemType>::contains(const ItemType& an_entry) const
 template<class ItemType>
 int ArrayBag<ItemType>::getIndexOf(const ItemType& target) const
 {  
+   if (hash_ != nullptr)
+   {
+      int slot = findIndexSlot(target, hash_(target));
+      return slot > -1 ? index_table_[slot].item_index : -1;
+   }  // end if
+
 	bool found = false;
   int result = -1;
   int search_index = 0;
@@ -130,7 +300,7 @@ int ArrayBag<ItemType>::getIndexOf(const ItemType& target) const
    while (!found && (search_index < item_count_))
    {
 
-      if (items_[search_index] == target)
+      if (isSameItem(items_[search_index], target))
       {
          found = true;
          result = search_index;
@@ -144,3 +314,160 @@ int ArrayBag<ItemType>::getIndexOf(const ItemType& target) const
    return result;
 }  // end getIndexOf
 
+/**
+	@param new_capacity the new size of items_, at least item_count_
+	@post items_ is a heap array of new_capacity slots holding the same items in the same order
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::resize(int new_capacity)
+{
+   ItemType* new_items = new ItemType[new_capacity];
+   for (int i = 0; i < item_count_; i++)
+   {
+      new_items[i] = std::move(items_[i]);
+   }  // end for
+   if (items_ != inline_items_)
+   {
+      delete[] items_;
+   }  // end if
+   items_ = new_items;
+   capacity_ = new_capacity;
+}  // end resize
+
+/**
+	@return true if left and right are the same item under the bag's equality test
+ **/
+template<class ItemType>
+bool ArrayBag<ItemType>::isSameItem(const ItemType& left, const ItemType& right) const
+{
+   return equal_ != nullptr ? equal_(left, right) : left == right;
+}  // end isSameItem
+
+/**
+	@param target to be found in items_
+	@param hash hash_(target)
+	@return the slot of index_table_ that refers to target, or -1 if items_ does not contain target
+ **/
+template<class ItemType>
+int ArrayBag<ItemType>::findIndexSlot(const ItemType& target, std::size_t hash) const
+{
+   if (index_table_.empty())
+   {
+      return -1;
+   }  // end if
+   std::size_t mask = index_table_.size() - 1;
+   std::size_t slot = hash & mask;
+   while (index_table_[slot].item_index > -1)
+   {
+      if (index_table_[slot].hash == hash && isSameItem(items_[index_table_[slot].item_index], target))
+      {
+         return static_cast<int>(slot);
+      }  // end if
+      slot = (slot + 1) & mask;
+   }  // end while
+   return -1;
+}  // end findIndexSlot
+
+/**
+	@param item_index a position in items_
+	@return the slot of index_table_ that refers to item_index
+ **/
+template<class ItemType>
+int ArrayBag<ItemType>::findIndexSlot(int item_index) const
+{
+   std::size_t mask = index_table_.size() - 1;
+   std::size_t slot = hash_(items_[item_index]) & mask;
+   while (index_table_[slot].item_index != item_index)
+   {
+      slot = (slot + 1) & mask;
+   }  // end while
+   return static_cast<int>(slot);
+}  // end findIndexSlot
+
+/**
+	@param item_index a position in items_ not yet in the index
+	@param hash hash_(items_[item_index])
+	@post index_table_ refers to item_index
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::insertIndex(int item_index, std::size_t hash)
+{
+   if (2 * static_cast<std::size_t>(item_index + 1) > index_table_.size())
+   {
+      rebuildIndex(index_table_.size() * 2); // keep the table at most half full
+   }  // end if
+   std::size_t mask = index_table_.size() - 1;
+   std::size_t slot = hash & mask;
+   while (index_table_[slot].item_index > -1)
+   {
+      slot = (slot + 1) & mask;
+   }  // end while
+   index_table_[slot].item_index = item_index;
+   index_table_[slot].hash = hash;
+}  // end insertIndex
+
+/**
+	@param slot a non-empty slot of index_table_
+	@post the slot is emptied and the entries after it are shifted back so every entry stays reachable
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::eraseIndexSlot(int slot)
+{
+   std::size_t mask = index_table_.size() - 1;
+   std::size_t hole = slot;
+   std::size_t next = (hole + 1) & mask;
+   while (index_table_[next].item_index > -1)
+   {
+      std::size_t home = index_table_[next].hash & mask;
+      // The entry can fill the hole unless its home slot lies after the hole
+      if (((next - home) & mask) >= ((next - hole) & mask))
+      {
+         index_table_[hole] = index_table_[next];
+         hole = next;
+      }  // end if
+      next = (next + 1) & mask;
+   }  // end while
+   index_table_[hole].item_index = -1;
+}  // end eraseIndexSlot
+
+/**
+	@param table_size the new size of index_table_, a power of 2
+	@post index_table_ refers to every item in items_
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::rebuildIndex(std::size_t table_size)
+{
+   std::vector<IndexSlot> old_table;
+   old_table.swap(index_table_);
+   IndexSlot empty_slot = {-1, 0};
+   index_table_.assign(table_size, empty_slot);
+   std::size_t mask = table_size - 1;
+   if (old_table.empty())
+   {
+      // Nothing cached yet, hash every item
+      for (int i = 0; i < item_count_; i++)
+      {
+         std::size_t hash = hash_(items_[i]);
+         std::size_t slot = hash & mask;
+         while (index_table_[slot].item_index > -1)
+         {
+            slot = (slot + 1) & mask;
+         }  // end while
+         index_table_[slot].item_index = i;
+         index_table_[slot].hash = hash;
+      }  // end for
+      return;
+   }  // end if
+   for (const IndexSlot& entry : old_table)
+   {
+      if (entry.item_index > -1)
+      {
+         std::size_t slot = entry.hash & mask;
+         while (index_table_[slot].item_index > -1)
+         {
+            slot = (slot + 1) & mask;
+         }  // end while
+         index_table_[slot] = entry;
+      }  // end if
+   }  // end for
+}  // end rebuildIndex
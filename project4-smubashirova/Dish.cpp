@@ -10,16 +10,18 @@
 */
 
 #include "Dish.hpp"
+#include <functional> // For std::hash
 
 // Default Constructor
 Dish::Dish() 
     : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
+    updateKey();
 }
 
 // Parameterized Constructor
 Dish::Dish(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type)
     : ingredients_(ingredients), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
-    setName(name);  // Use setName to validate the name
+    setName(name);  // Use setName to validate the name, which also computes the key
 }
 
 // Accessor Functions
@@ -51,6 +53,10 @@ std::string Dish::getCuisineType() const {
     }
 }
 
+Dish::CuisineType Dish::getCuisineTypeEnum() const {
+    return cuisine_type_;
+}
+
 // Mutator Functions
 void Dish::setName(const std::string& name) {
     if (isValidName(name)) {
@@ -58,6 +64,7 @@ void Dish::setName(const std::string& name) {
     } else {
         name_ = "UNKNOWN";
     }
+    updateKey();
 }
 
 void Dish::setIngredients(const std::vector<std::string>& ingredients) {
@@ -66,14 +73,17 @@ void Dish::setIngredients(const std::vector<std::string>& ingredients) {
 
 void Dish::setPrepTime(const int& prep_time) {
     prep_time_ = prep_time;
+    updateKey();
 }
 
 void Dish::setPrice(const double& price) {
     price_ = price;
+    updateKey();
 }
 
 void Dish::setCuisineType(const CuisineType& cuisine_type) {
     cuisine_type_ = cuisine_type;
+    updateKey();
 }
 
 // Helper function to check if the name is valid
@@ -87,7 +97,7 @@ bool Dish::isValidName(const std::string& name) const {
 }
 
 bool Dish::operator==(const Dish& rhs) const {
-    return name_ == rhs.name_ && prep_time_ == rhs.prep_time_ && 
+    return key_ == rhs.key_ && name_ == rhs.name_ && prep_time_ == rhs.prep_time_ && 
     price_ == rhs.price_ && cuisine_type_ == rhs.cuisine_type_;
 }
 
@@ -95,3 +105,15 @@ bool Dish::operator!=(const Dish& rhs) const {
     return !(*this == rhs);
 }
 
+std::size_t Dish::getKey() const {
+    return key_;
+}
+
+// Helper function to recompute key_ from the fields compared by ==
+void Dish::updateKey() {
+    std::size_t key = std::hash<std::string>()(name_);
+    key = key * 31 + static_cast<std::size_t>(cuisine_type_);
+    key = key * 31 + std::hash<int>()(prep_time_);
+    key = key * 31 + std::hash<double>()(price_);
+    key_ = key;
+}
\ No newline at end of file
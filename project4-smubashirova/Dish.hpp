@@ -17,6 +17,7 @@
 #include <iostream>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
+#include <cstddef> // For std::size_t
 
 class Dish {
 public:
@@ -59,6 +60,11 @@ public:
      */
     Dish(const std::string& name, const std::vector<std::string>& ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER);
 
+    /**
+     * Virtual destructor, so a Kitchen can delete any kind of dish through a `Dish*`.
+     */
+    virtual ~Dish() = default;
+
     // Accessors
     /**
      * @return The name of the dish.
@@ -85,6 +91,11 @@ public:
      */
     std::string getCuisineType() const;
 
+    /**
+     * @return The cuisine type of the dish as a CuisineType enum.
+     */
+    CuisineType getCuisineTypeEnum() const;
+
     // Mutators
     /**
      * Sets the name of the dish.
@@ -146,6 +157,13 @@ public:
     */
     bool operator!=(const Dish& rhs) const; // Overloading the != operator
 
+    /**
+     * @return A hash of the fields `==` compares (name, cuisine type, preparation time, and price).
+     * It is computed when the dish is constructed and whenever one of those fields is set,
+     * so equal dishes always have equal keys and reading it is O(1).
+     */
+    std::size_t getKey() const;
+
     /**
     * Modifies the dish to accommodate specific dietary needs.
     * @param request A reference to a DietaryRequest structure specifying
@@ -160,6 +178,7 @@ private:
     int prep_time_;
     double price_;
     CuisineType cuisine_type_;
+    std::size_t key_; // Hash of name_, cuisine_type_, prep_time_ and price_, see getKey()
 
     // Helper function to check if the name is valid
     /**
@@ -168,6 +187,9 @@ private:
      * @return True if the name contains only alphabetic characters and spaces; false otherwise.
      */
     bool isValidName(const std::string& name) const;
+
+    // Helper function to recompute key_ after name_, cuisine_type_, prep_time_ or price_ changed
+    void updateKey();
 };
 
 #endif // DISH_HPP
@@ -16,7 +16,9 @@
  * Default constructor.
  * Default-initializes all private members.
  */
-Kitchen::Kitchen() : ArrayBag<Dish*>(), total_prep_time_(0), count_elaborate_(0) {}
+Kitchen::Kitchen() : ArrayBag<Dish*>(), total_prep_time_(0), count_elaborate_(0), cuisine_counts_{} {
+    useHashedIndex(&Kitchen::hashDishKey, &Kitchen::isSameDish); // newOrder and serveDish look dishes up by value
+}
 
 /**
  * Parameterized constructor.
@@ -25,7 +27,8 @@ Kitchen::Kitchen() : ArrayBag<Dish*>(), total_prep_time_(0), count_elaborate_(0)
  * @post Initializes the kitchen by reading dishes from the CSV file and
  *       storing them as `Dish*`.
  */
-Kitchen::Kitchen(const std::string& filename) {
+Kitchen::Kitchen(const std::string& filename) : ArrayBag<Dish*>(), total_prep_time_(0), count_elaborate_(0), cuisine_counts_{} {
+    useHashedIndex(&Kitchen::hashDishKey, &Kitchen::isSameDish); // newOrder and serveDish look dishes up by value
     std::ifstream file(filename); // Open the file for reading
 
     // Skip the first line (assumed to be headers)
@@ -206,8 +209,8 @@ Kitchen::Kitchen(const std::string& filename) {
         }
 
         // Add the dish to the kitchen if it was successfully created
-        if (new_dish != nullptr) {
-            this->newOrder(new_dish); // Add the dish to the kitchen's orders
+        if (new_dish != nullptr && !this->newOrder(new_dish)) {
+            delete new_dish; // An equal dish is already in the kitchen
         }
     }
     file.close(); // Close the file
@@ -226,9 +229,10 @@ Kitchen::Kitchen(const std::string& filename) {
  */
 bool Kitchen::newOrder(Dish* new_dish)
 {
-    if (add(new_dish))
+    if (new_dish != nullptr && add(new_dish))
     {
         total_prep_time_ += new_dish->getPrepTime();
+        cuisine_counts_[new_dish->getCuisineTypeEnum()]++;
         //std::cout<< "Dish added: "<<new_dish.getName() << std::endl;
         //if the new dish has 5 or more ingredients AND takes an hour or more to prepare, increment count_elaborate_
         if (new_dish->getIngredients().size() >= 5 && new_dish->getPrepTime() >= 60)
@@ -248,23 +252,35 @@ bool Kitchen::newOrder(Dish* new_dish)
  * @post : Removes the dish from the kitchen and updates the preparation
  time sum.
  If the `Dish` is elaborate, it also updates the elaborate count.
+ Only the dish at dish_to_remove is removed, not an equal copy, and
+ it is not deallocated: the caller owns it again. A dish changed by
+ its setters after newOrder is still found by its pointer, though the
+ totals assume its prep time, cuisine and ingredients are unchanged.
  */
 bool Kitchen::serveDish(Dish* dish_to_remove)
 {
-    if (getCurrentSize() == 0)
+    if (dish_to_remove == nullptr || getCurrentSize() == 0)
     {
         return false;
     }
-    if (remove(dish_to_remove))
+    // The hashed lookup finds equal copies too, and misses a dish whose setters changed its key
+    // after newOrder, so check the pointer and otherwise look for the pointer itself
+    int found_index = getIndexOf(dish_to_remove);
+    if (found_index > -1 && items_[found_index] == dish_to_remove)
     {
-        total_prep_time_ -= dish_to_remove->getPrepTime();
-        if (dish_to_remove->getIngredients().size() >= 5 && dish_to_remove->getPrepTime() >= 60)
-        {
-            count_elaborate_--;
-        }
-        return true;
+        remove(dish_to_remove);
     }
-    return false;
+    else if (removeIf([dish_to_remove](Dish* const& dish) { return dish == dish_to_remove; }) == 0)
+    {
+        return false;
+    }
+    total_prep_time_ -= dish_to_remove->getPrepTime();
+    cuisine_counts_[dish_to_remove->getCuisineTypeEnum()]--;
+    if (dish_to_remove->getIngredients().size() >= 5 && dish_to_remove->getPrepTime() >= 60)
+    {
+        count_elaborate_--;
+    }
+    return true;
 }
 
 /**
@@ -292,15 +308,7 @@ int Kitchen::calculateAvgPrepTime() const
     {
         return 0;
     }
-    double total_prep_time_ = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
-    {
-        total_prep_time_ += items_[i]->getPrepTime();
-    }
-    total_prep_time_ = total_prep_time_ / getCurrentSize();
-    // std::cout<< "Total prep time: "<<total_prep_time_ << std::endl;
-    // std::cout<<"rounded: "<<round(total_prep_time_)<<std::endl;
-    return round(total_prep_time_);
+    return round(double(total_prep_time_) / getCurrentSize());
 }
 
 /**
@@ -360,15 +368,57 @@ double Kitchen::calculateElaboratePercentage() const
  uppercase input will match.
  */
 int Kitchen::tallyCuisineTypes(const std::string& cuisine_type) const{
-    int count = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
+    int index = cuisineIndexOf(cuisine_type);
+    if (index < 0)
     {
-        if (items_[i]->getCuisineType() == cuisine_type)
+        return 0;
+    }
+    return cuisine_counts_[index];
+}
+
+/**
+ * @param : A cuisine type (a CuisineType enum).
+ * @return : An integer tally of the number of dishes in the kitchen of the
+ given cuisine type. The tallies are kept up to date by newOrder and
+ serveDish, so this takes constant time.
+ */
+int Kitchen::tallyCuisineTypes(Dish::CuisineType cuisine_type) const{
+    return cuisine_counts_[cuisine_type];
+}
+
+/**
+ * @param should_release A predicate on `const Dish*` that picks the dishes to release.
+ * @post Removes the picked dishes in one stable pass, updates the totals once, and deallocates the dishes.
+ * @return The number of dishes released.
+ */
+template<class Predicate>
+int Kitchen::releaseDishesIf(Predicate should_release)
+{
+    int released_prep_time = 0;
+    int released_elaborate = 0;
+    int released_cuisines[CUISINE_TYPE_COUNT] = {};
+    int released = removeIf([&](Dish* const& dish) {
+        if (!should_release(dish))
+        {
+            return false;
+        }
+        released_prep_time += dish->getPrepTime();
+        released_cuisines[dish->getCuisineTypeEnum()]++;
+        // Check the prep time first; getIngredients() copies the list
+        if (dish->getPrepTime() >= 60 && dish->getIngredients().size() >= 5)
         {
-            count++;
+            released_elaborate++;
         }
+        delete dish; // removeIf does not look at a removed item again
+        return true;
+    });
+    total_prep_time_ -= released_prep_time;
+    count_elaborate_ -= released_elaborate;
+    for (int i = 0; i < CUISINE_TYPE_COUNT; i++)
+    {
+        cuisine_counts_[i] -= released_cuisines[i];
     }
-    return count;
+    return released;
 }
 
 /**
@@ -383,17 +433,9 @@ int Kitchen::tallyCuisineTypes(const std::string& cuisine_type) const{
  */
 int Kitchen::releaseDishesBelowPrepTime(const int& prep_time)
 {
-    int count = 0;
-    int num= getCurrentSize();
-    for (int i = 0; i < num; i++)
-    {
-        if (items_[i]->getPrepTime() < prep_time)
-        {
-            count++;
-            serveDish(items_[i]);
-        }
-    }
-    return count;
+    return releaseDishesIf([prep_time](const Dish* dish) {
+        return dish->getPrepTime() < prep_time;
+    });
 }
 
 /**
@@ -413,16 +455,18 @@ int Kitchen::releaseDishesBelowPrepTime(const int& prep_time)
  */
 int Kitchen::releaseDishesOfCuisineType(const std::string& cuisine_type)
 {
-    int count = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
+    if (cuisine_type == "ALL")
     {
-        if (items_[i]->getCuisineType() == cuisine_type)
-        {
-            count++;
-            serveDish(items_[i]);
-        }
+        return releaseDishesIf([](const Dish*) { return true; });
+    }
+    int index = cuisineIndexOf(cuisine_type);
+    if (index < 0)
+    {
+        return 0;
     }
-    return count;
+    return releaseDishesIf([index](const Dish* dish) {
+        return dish->getCuisineTypeEnum() == index;
+    });
 }
 
 /**
@@ -449,13 +493,13 @@ int Kitchen::releaseDishesOfCuisineType(const std::string& cuisine_type)
  */
 void Kitchen::kitchenReport() const
 {
-    std::cout << "ITALIAN: " << tallyCuisineTypes("ITALIAN") << std::endl;
-    std::cout << "MEXICAN: " << tallyCuisineTypes("MEXICAN") << std::endl;
-    std::cout << "CHINESE: " << tallyCuisineTypes("CHINESE") << std::endl;
-    std::cout << "INDIAN: " << tallyCuisineTypes("INDIAN") << std::endl;
-    std::cout << "AMERICAN: " << tallyCuisineTypes("AMERICAN") << std::endl;
-    std::cout << "FRENCH: " << tallyCuisineTypes("FRENCH") << std::endl;
-    std::cout << "OTHER: " << tallyCuisineTypes("OTHER") << std::endl<<std::endl;
+    std::cout << "ITALIAN: " << tallyCuisineTypes(Dish::CuisineType::ITALIAN) << std::endl;
+    std::cout << "MEXICAN: " << tallyCuisineTypes(Dish::CuisineType::MEXICAN) << std::endl;
+    std::cout << "CHINESE: " << tallyCuisineTypes(Dish::CuisineType::CHINESE) << std::endl;
+    std::cout << "INDIAN: " << tallyCuisineTypes(Dish::CuisineType::INDIAN) << std::endl;
+    std::cout << "AMERICAN: " << tallyCuisineTypes(Dish::CuisineType::AMERICAN) << std::endl;
+    std::cout << "FRENCH: " << tallyCuisineTypes(Dish::CuisineType::FRENCH) << std::endl;
+    std::cout << "OTHER: " << tallyCuisineTypes(Dish::CuisineType::OTHER) << std::endl<<std::endl;
     std::cout << "AVERAGE PREP TIME: " << calculateAvgPrepTime() << std::endl;
     std::cout << "ELABORATE DISHES: " << calculateElaboratePercentage() << "%" << std::endl;
 }
@@ -484,6 +528,40 @@ void Kitchen::displayMenu() const {
     }
 }
 
+/**
+ * @param cuisine_type A string in ["ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"].
+ * @return The matching CuisineType as an index into cuisine_counts_, or -1 if the string matches none of them.
+ */
+int Kitchen::cuisineIndexOf(const std::string& cuisine_type) {
+    static const char* const names[CUISINE_TYPE_COUNT] = {"ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"};
+    for (int i = 0; i < CUISINE_TYPE_COUNT; i++)
+    {
+        if (cuisine_type == names[i])
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @param dish A pointer to a dish in the kitchen.
+ * @return The dish's precomputed key, so dishes equal under `==` land in the same slot, or 0 for nullptr.
+ */
+std::size_t Kitchen::hashDishKey(Dish* const& dish) {
+    return dish != nullptr ? dish->getKey() : 0;
+}
+
+/**
+ * @param left A pointer to a dish.
+ * @param right A pointer to a dish.
+ * @return True if the dishes pointed to are equal under `==`, so the kitchen dedups by value rather than by address;
+ a nullptr only matches a nullptr.
+ */
+bool Kitchen::isSameDish(Dish* const& left, Dish* const& right) {
+    return left == right || (left != nullptr && right != nullptr && *left == *right);
+}
+
 /**
  * Destructor.
  * @post Deallocates all dynamically allocated dishes to prevent memory
@@ -23,6 +23,8 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+// for std::size_t
+#include <cstddef>
 
 class Kitchen : public ArrayBag<Dish*> {
     public:
@@ -69,6 +71,10 @@ class Kitchen : public ArrayBag<Dish*> {
          * @post : Removes the dish from the kitchen and updates the preparation
          time sum.
          If the `Dish` is elaborate, it also updates the elaborate count.
+         Only the dish at dish_to_remove is removed, not an equal copy, and
+         it is not deallocated: the caller owns it again. A dish changed by
+         its setters after newOrder is still found by its pointer, though the
+         totals assume its prep time, cuisine and ingredients are unchanged.
          */
         bool serveDish(Dish* dish_to_remove);
 
@@ -113,6 +119,14 @@ class Kitchen : public ArrayBag<Dish*> {
          */
         int tallyCuisineTypes(const std::string& cuisine_type) const;
 
+        /**
+         * @param : A cuisine type (a CuisineType enum).
+         * @return : An integer tally of the number of dishes in the kitchen of the
+         given cuisine type. The tallies are kept up to date by newOrder and
+         serveDish, so this takes constant time.
+         */
+        int tallyCuisineTypes(Dish::CuisineType cuisine_type) const;
+
         /**
          * @param : A reference to an integer representing the preparation time
          threshold of the dishes to be removed from
@@ -121,6 +135,8 @@ class Kitchen : public ArrayBag<Dish*> {
          less than the given time.
          If no time is given, removes all dishes from the kitchen. Ignore
          negative input.
+         The removed dishes are deallocated, and the remaining dishes keep
+         their order. Takes a single pass over the kitchen.
          * @return : The number of dishes removed from the kitchen.
          */
         int releaseDishesBelowPrepTime(const int& prep_time);
@@ -139,6 +155,8 @@ class Kitchen : public ArrayBag<Dish*> {
          uppercase input will match.
          If the input string does not match one of the expected cuisine
          types, do not remove any dishes.
+         The removed dishes are deallocated, and the remaining dishes keep
+         their order. Takes a single pass over the kitchen.
          */
         int releaseDishesOfCuisineType(const std::string& cuisine_type);
 
@@ -185,6 +203,36 @@ class Kitchen : public ArrayBag<Dish*> {
     private:
         int total_prep_time_; // An integer sum of the preparation times of all the dishes currently in the kitchen. (totalprep_time)
         int count_elaborate_; // An integer count of all of the elaborate dishes in the kitchen. An elaborate dish is one that has 5 or more ingredients, and a prep time of an hour or more. (countelaborate)
+        static const int CUISINE_TYPE_COUNT = Dish::CuisineType::OTHER + 1; // The number of CuisineType values
+        int cuisine_counts_[CUISINE_TYPE_COUNT]; // The number of dishes in the kitchen of each cuisine type, indexed by CuisineType
+
+        /**
+         * @param cuisine_type A string in ["ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"].
+         * @return The matching CuisineType as an index into cuisine_counts_, or -1 if the string matches none of them.
+         */
+        static int cuisineIndexOf(const std::string& cuisine_type);
+
+        /**
+         * @param should_release A predicate on `const Dish*` that picks the dishes to release.
+         * @post Removes the picked dishes in one stable pass, updates the totals once, and deallocates the dishes.
+         * @return The number of dishes released.
+         */
+        template<class Predicate>
+        int releaseDishesIf(Predicate should_release);
+
+        /**
+         * @param dish A pointer to a dish in the kitchen.
+         * @return The dish's precomputed key, so dishes equal under `==` land in the same slot, or 0 for nullptr.
+         */
+        static std::size_t hashDishKey(Dish* const& dish);
+
+        /**
+         * @param left A pointer to a dish.
+         * @param right A pointer to a dish.
+         * @return True if the dishes pointed to are equal under `==`, so the kitchen dedups by value rather than by address;
+         a nullptr only matches a nullptr.
+         */
+        static bool isSameDish(Dish* const& left, Dish* const& right);
 };
 
 #endif // KITCHEN_HPP
\ No newline at end of file
@@ -0,0 +1,91 @@
+//  Assignment: Project 4
+//  Description: This program times the single-pass release functions on a
+//  kitchen of 100k dishes against serving the same dishes one at a time,
+//  and checks both leave the same dishes and totals.
+
+#include "Kitchen.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Milliseconds taken by one call of work
+template <class Work>
+double timeMs(Work work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// A dish name for number n; dish names may only hold letters and spaces, so n is spelled in base 26
+std::string dishName(int n) {
+    std::string letters;
+    do {
+        letters.insert(letters.begin(), static_cast<char>('a' + n % 26));
+        n /= 26;
+    } while (n > 0);
+    return "Dish " + letters;
+}
+
+const int DISHES = 100000;
+
+// Orders the same DISHES dishes, with random prep times, ingredient counts and cuisines, into kitchen
+void fillKitchen(Kitchen& kitchen) {
+    std::mt19937 rng(235);
+    for (int i = 0; i < DISHES; i++) {
+        std::vector<std::string> ingredients(1 + rng() % 8, "Rice");
+        int prep_time = static_cast<int>(rng() % 120);
+        Dish::CuisineType cuisine_type = static_cast<Dish::CuisineType>(rng() % (Dish::CuisineType::OTHER + 1));
+        kitchen.newOrder(new Dessert(dishName(i), ingredients, prep_time, 5.00, cuisine_type, Dessert::FlavorProfile::SWEET, 3, false));
+    }
+}
+
+// A kitchen whose dishes can be listed, to serve them one at a time
+class ListedKitchen : public Kitchen {
+    public:
+        std::vector<Dish*> dishes() const {
+            return std::vector<Dish*>(items_, items_ + item_count_);
+        }
+};
+
+// Releases the dishes should_release picks with release, and from a second kitchen by serving
+// them one at a time; true if both kitchens end up with the same number of dishes and totals
+template <class Release, class Predicate>
+bool benchmarkRelease(const char* label, Release release, Predicate should_release) {
+    ListedKitchen single_pass, one_at_a_time;
+    fillKitchen(single_pass);
+    fillKitchen(one_at_a_time);
+
+    int released = 0;
+    double single_pass_ms = timeMs([&] { released = release(single_pass); });
+    int served = 0;
+    double served_ms = timeMs([&] {
+        for (Dish* dish : one_at_a_time.dishes()) {
+            if (should_release(dish) && one_at_a_time.serveDish(dish)) {
+                delete dish; // serveDish hands the dish back; the release functions free theirs too
+                served++;
+            }
+        }
+    });
+    std::cout << DISHES << " dishes, " << label << ": single pass " << single_pass_ms << " ms, serveDish one at a time "
+              << served_ms << " ms (" << released << " released)" << std::endl;
+    return released == served && single_pass.getCurrentSize() == one_at_a_time.getCurrentSize()
+           && single_pass.getPrepTimeSum() == one_at_a_time.getPrepTimeSum()
+           && single_pass.elaborateDishCount() == one_at_a_time.elaborateDishCount()
+           && single_pass.tallyCuisineTypes("FRENCH") == one_at_a_time.tallyCuisineTypes("FRENCH");
+}
+
+int main() {
+    bool ok = benchmarkRelease("releaseDishesBelowPrepTime(50)",
+                               [](Kitchen& kitchen) { return kitchen.releaseDishesBelowPrepTime(50); },
+                               [](const Dish* dish) { return dish->getPrepTime() < 50; });
+    ok = benchmarkRelease("releaseDishesOfCuisineType(\"FRENCH\")",
+                          [](Kitchen& kitchen) { return kitchen.releaseDishesOfCuisineType("FRENCH"); },
+                          [](const Dish* dish) { return dish->getCuisineTypeEnum() == Dish::CuisineType::FRENCH; }) && ok;
+    if (!ok) {
+        std::cout << "FAILURE: a benchmark checked the wrong answer" << std::endl;
+        return 1;
+    }
+    return 0;
+}
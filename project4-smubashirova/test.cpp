@@ -0,0 +1,219 @@
+//  Assignment: Project 4
+//  Description: This program tests that ArrayBag::removeIf and the Kitchen
+//  release functions remove the picked items in one stable pass and keep
+//  the prep-time, elaborate and cuisine totals current, and that serveDish
+//  removes only the dish it is given, even after its setters changed it,
+//  and hands it back to the caller.
+
+#include "Kitchen.hpp"
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Exposes the items of a bag in their order in items_
+template <class ItemType>
+class BagProbe : public ArrayBag<ItemType> {
+    public:
+        std::vector<ItemType> items() const {
+            return std::vector<ItemType>(this->items_, this->items_ + this->item_count_);
+        }
+};
+
+// Exposes the names of a kitchen's dishes in their order in items_
+class KitchenProbe : public Kitchen {
+    public:
+        using Kitchen::Kitchen;
+
+        std::vector<std::string> names() const {
+            std::vector<std::string> names;
+            for (int i = 0; i < item_count_; i++) {
+                names.push_back(items_[i]->getName());
+            }
+            return names;
+        }
+
+        template <class Predicate>
+        int countIf(Predicate picked) const {
+            int count = 0;
+            for (int i = 0; i < item_count_; i++) {
+                count += picked(items_[i]) ? 1 : 0;
+            }
+            return count;
+        }
+};
+
+std::size_t hashInt(const int& item) {
+    return static_cast<std::size_t>(item);
+}
+
+// A dish name for number n; dish names may only hold letters and spaces, so n is spelled in base 26
+std::string dishName(int n) {
+    std::string letters;
+    do {
+        letters.insert(letters.begin(), static_cast<char>('a' + n % 26));
+        n /= 26;
+    } while (n > 0);
+    return "Dish " + letters;
+}
+
+// A dessert with ingredient_count ingredients
+Dish* makeDish(const std::string& name, int ingredient_count, int prep_time, Dish::CuisineType cuisine_type) {
+    std::vector<std::string> ingredients;
+    for (int i = 0; i < ingredient_count; i++) {
+        ingredients.push_back("Ingredient " + std::string(1, static_cast<char>('A' + i)));
+    }
+    return new Dessert(name, ingredients, prep_time, 5.00, cuisine_type, Dessert::FlavorProfile::SWEET, 3, false);
+}
+
+// Checks the kitchen's totals against those worked out from scratch for its dishes
+void checkTotals(const Kitchen& kitchen, int prep_time_sum, int elaborate, const std::vector<int>& cuisine_counts) {
+    assert(kitchen.getPrepTimeSum() == prep_time_sum && kitchen.elaborateDishCount() == elaborate);
+    for (int i = 0; i <= Dish::CuisineType::OTHER; i++) {
+        assert(kitchen.tallyCuisineTypes(static_cast<Dish::CuisineType>(i)) == cuisine_counts[i]);
+    }
+}
+
+int main() {
+    // Test removeIf: each item is looked at once, in order, and the rest keep their order
+    BagProbe<int> bag;
+    for (int i = 0; i < 20; i++) {
+        bag.add(i);
+    }
+    std::vector<int> visited;
+    int removed = bag.removeIf([&](const int& item) {
+        visited.push_back(item);
+        return item % 2 == 0;
+    });
+    assert(removed == 10 && bag.getCurrentSize() == 10 && visited.size() == 20);
+    for (int i = 0; i < 20; i++) {
+        assert(visited[i] == i);
+    }
+    for (int i = 0; i < 10; i++) {
+        assert(bag.items()[i] == 2 * i + 1);
+    }
+
+    // Test removeIf: the hashed index follows the moved items
+    BagProbe<int> hashed;
+    hashed.useHashedIndex(&hashInt);
+    for (int i = 0; i < 100; i++) {
+        hashed.add(i);
+    }
+    assert(hashed.removeIf([](const int& item) { return item % 3 != 0; }) == 66);
+    assert(hashed.getCurrentSize() == 34 && hashed.items()[5] == 15 && hashed.items()[33] == 99);
+    assert(hashed.contains(99) && !hashed.contains(98) && !hashed.add(30) && hashed.add(31));
+    assert(hashed.remove(0) && !hashed.contains(0) && hashed.contains(31));
+    assert(hashed.removeIf([](const int&) { return false; }) == 0 && hashed.getCurrentSize() == 34);
+    std::cout << "removeIf: SUCCESS for order and the hashed index" << std::endl;
+
+    // Test the release functions: the kept dishes keep their order and the totals are updated
+    KitchenProbe kitchen;
+    kitchen.newOrder(makeDish("Soup", 2, 10, Dish::CuisineType::OTHER));
+    kitchen.newOrder(makeDish("Lasagna", 6, 90, Dish::CuisineType::ITALIAN));
+    kitchen.newOrder(makeDish("Tiramisu", 5, 30, Dish::CuisineType::ITALIAN));
+    kitchen.newOrder(makeDish("Tacos", 3, 20, Dish::CuisineType::MEXICAN));
+    kitchen.newOrder(makeDish("Ratatouille", 5, 70, Dish::CuisineType::FRENCH));
+    kitchen.newOrder(makeDish("Salad", 3, 5, Dish::CuisineType::FRENCH));
+    kitchen.newOrder(makeDish("Flan", 3, 45, Dish::CuisineType::MEXICAN));
+    checkTotals(kitchen, 270, 2, {2, 2, 0, 0, 0, 2, 1});
+
+    assert(kitchen.releaseDishesBelowPrepTime(25) == 3);
+    assert((kitchen.names() == std::vector<std::string>{"Lasagna", "Tiramisu", "Ratatouille", "Flan"}));
+    checkTotals(kitchen, 235, 2, {2, 1, 0, 0, 0, 1, 0});
+    assert(kitchen.calculateAvgPrepTime() == 59 && kitchen.calculateElaboratePercentage() == 50.00);
+
+    assert(kitchen.releaseDishesOfCuisineType("ITALIAN") == 2);
+    assert((kitchen.names() == std::vector<std::string>{"Ratatouille", "Flan"}));
+    checkTotals(kitchen, 115, 1, {0, 1, 0, 0, 0, 1, 0});
+    assert(kitchen.tallyCuisineTypes("ITALIAN") == 0 && kitchen.tallyCuisineTypes("FRENCH") == 1);
+
+    // Test the release functions: unknown cuisines and negative times release nothing, "ALL" releases everything
+    assert(kitchen.releaseDishesOfCuisineType("UNKNOWN") == 0 && kitchen.releaseDishesOfCuisineType("french") == 0);
+    assert(kitchen.releaseDishesBelowPrepTime(-5) == 0 && kitchen.getCurrentSize() == 2);
+    assert(kitchen.releaseDishesOfCuisineType("ALL") == 2 && kitchen.isEmpty());
+    checkTotals(kitchen, 0, 0, {0, 0, 0, 0, 0, 0, 0});
+    std::cout << "release: SUCCESS for order and totals" << std::endl;
+
+    // Test the release functions: 1000 random dishes against totals worked out from scratch
+    std::mt19937 rng(235);
+    KitchenProbe big_kitchen;
+    std::vector<std::string> names;
+    std::vector<int> prep_times, ingredient_counts, cuisines;
+    for (int i = 0; i < 1000; i++) {
+        names.push_back(dishName(i));
+        prep_times.push_back(static_cast<int>(rng() % 120));
+        ingredient_counts.push_back(1 + static_cast<int>(rng() % 8));
+        cuisines.push_back(static_cast<int>(rng() % (Dish::CuisineType::OTHER + 1)));
+        assert(big_kitchen.newOrder(makeDish(names[i], ingredient_counts[i], prep_times[i], static_cast<Dish::CuisineType>(cuisines[i]))));
+    }
+    for (int round = 0; round < 2; round++) {
+        if (round == 0) {
+            big_kitchen.releaseDishesBelowPrepTime(50);
+        } else {
+            big_kitchen.releaseDishesOfCuisineType("CHINESE");
+        }
+        std::vector<std::string> kept;
+        int prep_time_sum = 0, elaborate = 0;
+        std::vector<int> cuisine_counts(Dish::CuisineType::OTHER + 1, 0);
+        for (int i = 0; i < 1000; i++) {
+            if (prep_times[i] < 50 || (round == 1 && cuisines[i] == Dish::CuisineType::CHINESE)) {
+                continue;
+            }
+            kept.push_back(names[i]);
+            prep_time_sum += prep_times[i];
+            elaborate += (ingredient_counts[i] >= 5 && prep_times[i] >= 60) ? 1 : 0;
+            cuisine_counts[cuisines[i]]++;
+        }
+        assert(big_kitchen.names() == kept);
+        checkTotals(big_kitchen, prep_time_sum, elaborate, cuisine_counts);
+    }
+    std::cout << "release: SUCCESS for 1000 random dishes" << std::endl;
+
+    // Test the release functions: the dishes in Dishes.csv, against counts worked out from scratch
+    KitchenProbe menu("Dishes.csv");
+    int menu_size = menu.getCurrentSize();
+    int below_twenty = menu.countIf([](const Dish* dish) { return dish->getPrepTime() < 20; });
+    int italian = menu.countIf([](const Dish* dish) {
+        return dish->getPrepTime() >= 20 && dish->getCuisineTypeEnum() == Dish::CuisineType::ITALIAN;
+    });
+    assert(menu_size > 0 && below_twenty > 0 && italian > 0);
+    assert(menu.releaseDishesBelowPrepTime(20) == below_twenty && menu.releaseDishesOfCuisineType("ITALIAN") == italian);
+    assert(menu.releaseDishesOfCuisineType("UNKNOWN") == 0 && menu.getCurrentSize() == menu_size - below_twenty - italian);
+    assert(menu.tallyCuisineTypes("ITALIAN") == 0 && menu.countIf([](const Dish* dish) { return dish->getPrepTime() < 20; }) == 0);
+    std::cout << "release: SUCCESS for Dishes.csv" << std::endl;
+
+    // Test serveDish: only the stored pointer is served, and it is handed back to the caller
+    Kitchen serve_kitchen;
+    Dish* stored = makeDish("Pudding", 2, 15, Dish::CuisineType::AMERICAN);
+    Dish* equal_copy = makeDish("Pudding", 4, 15, Dish::CuisineType::AMERICAN);
+    assert(serve_kitchen.newOrder(stored) && !serve_kitchen.newOrder(equal_copy));
+    assert(!serve_kitchen.serveDish(equal_copy) && serve_kitchen.getCurrentSize() == 1 && serve_kitchen.getPrepTimeSum() == 15);
+    assert(serve_kitchen.serveDish(stored) && serve_kitchen.isEmpty() && !serve_kitchen.serveDish(stored));
+    assert(serve_kitchen.tallyCuisineTypes("AMERICAN") == 0 && serve_kitchen.getPrepTimeSum() == 0);
+    assert(stored->getName() == "Pudding"); // Still the caller's, not deallocated
+    assert(serve_kitchen.newOrder(equal_copy) && serve_kitchen.serveDish(equal_copy) && serve_kitchen.isEmpty());
+    delete stored;
+    delete equal_copy;
+    std::cout << "serveDish: SUCCESS for stored dishes and equal copies" << std::endl;
+
+    // Test serveDish: nullptr is never served, and a dish re-keyed by its setters is still found by its pointer
+    assert(!serve_kitchen.serveDish(nullptr) && !serve_kitchen.newOrder(nullptr) && serve_kitchen.isEmpty());
+    Dish* renamed = makeDish("Brownie", 3, 25, Dish::CuisineType::AMERICAN);
+    Dish* repriced = makeDish("Churros", 2, 20, Dish::CuisineType::MEXICAN);
+    Dish* untouched = makeDish("Baklava", 4, 40, Dish::CuisineType::OTHER);
+    assert(serve_kitchen.newOrder(renamed) && serve_kitchen.newOrder(repriced) && serve_kitchen.newOrder(untouched));
+    assert(!serve_kitchen.serveDish(nullptr) && serve_kitchen.getCurrentSize() == 3);
+    renamed->setName("Blondie");
+    repriced->setPrice(9.50);
+    assert(serve_kitchen.serveDish(renamed) && serve_kitchen.getCurrentSize() == 2 && serve_kitchen.getPrepTimeSum() == 60);
+    assert(!serve_kitchen.serveDish(renamed) && serve_kitchen.serveDish(untouched));
+    assert(serve_kitchen.serveDish(repriced) && serve_kitchen.isEmpty() && serve_kitchen.getPrepTimeSum() == 0);
+    assert(serve_kitchen.tallyCuisineTypes("AMERICAN") == 0 && serve_kitchen.tallyCuisineTypes("MEXICAN") == 0);
+    delete renamed;
+    delete repriced;
+    delete untouched;
+    std::cout << "serveDish: SUCCESS for nullptr and dishes changed after newOrder" << std::endl;
+    return 0;
+}